@@ -0,0 +1,9 @@
+/* Create an enumeraion defining all of the precomputed identifiers needed for the standard modules. */
+enum {
+	_button_id,
+	_gpio_id,
+	_led_id,
+	_uart0_id,
+	_wdt_id,
+};
+/* NOTE: The identifiers in this enumeration must match the order of the module addresses stored in the 'lf_modules' array. */
@@ -0,0 +1,105 @@
+/* atomic.h - Operations on words that are shared between threads or interrupts without a lock. */
+
+#ifndef __lf_atomic_h__
+#define __lf_atomic_h__
+
+#include <flipper/types.h>
+
+#if defined(__AVR__)
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/* The AVR has no atomic instructions, so each operation is done with interrupts disabled. */
+#define lf_atomic_begin() uint8_t _sreg = SREG; cli()
+#define lf_atomic_end() SREG = _sreg
+
+static inline uint32_t lf_atomic_load(uint32_t *word) {
+	lf_atomic_begin();
+	uint32_t value = *word;
+	lf_atomic_end();
+	return value;
+}
+
+static inline void lf_atomic_store(uint32_t *word, uint32_t value) {
+	lf_atomic_begin();
+	*word = value;
+	lf_atomic_end();
+}
+
+static inline bool lf_atomic_cas(uint32_t *word, uint32_t *expected, uint32_t desired) {
+	lf_atomic_begin();
+	bool swapped = (*word == *expected);
+	if (swapped) *word = desired;
+	else *expected = *word;
+	lf_atomic_end();
+	return swapped;
+}
+
+static inline uint32_t lf_atomic_exchange(uint32_t *word, uint32_t value) {
+	lf_atomic_begin();
+	uint32_t previous = *word;
+	*word = value;
+	lf_atomic_end();
+	return previous;
+}
+
+static inline uint32_t lf_atomic_add(uint32_t *word, uint32_t value) {
+	lf_atomic_begin();
+	uint32_t sum = (*word += value);
+	lf_atomic_end();
+	return sum;
+}
+
+static inline void *lf_atomic_load_pointer(void **pointer) {
+	lf_atomic_begin();
+	void *value = *pointer;
+	lf_atomic_end();
+	return value;
+}
+
+static inline void lf_atomic_store_pointer(void **pointer, void *value) {
+	lf_atomic_begin();
+	*pointer = value;
+	lf_atomic_end();
+}
+
+#else
+
+/* Loads the word, ordered before any loads and stores that follow it. */
+static inline uint32_t lf_atomic_load(uint32_t *word) {
+	return __atomic_load_n(word, __ATOMIC_ACQUIRE);
+}
+
+/* Stores the word, ordered after any loads and stores that precede it. */
+static inline void lf_atomic_store(uint32_t *word, uint32_t value) {
+	__atomic_store_n(word, value, __ATOMIC_RELEASE);
+}
+
+/* Replaces the word with 'desired' if it still holds 'expected'. Otherwise, loads its current value into 'expected'. */
+static inline bool lf_atomic_cas(uint32_t *word, uint32_t *expected, uint32_t desired) {
+	return __atomic_compare_exchange_n(word, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+/* Replaces the word with 'value', returning what it held before. */
+static inline uint32_t lf_atomic_exchange(uint32_t *word, uint32_t value) {
+	return __atomic_exchange_n(word, value, __ATOMIC_ACQ_REL);
+}
+
+/* Adds 'value' to the word, returning the sum. */
+static inline uint32_t lf_atomic_add(uint32_t *word, uint32_t value) {
+	return __atomic_add_fetch(word, value, __ATOMIC_ACQ_REL);
+}
+
+/* Pointer sized variants of the load and store above. */
+static inline void *lf_atomic_load_pointer(void **pointer) {
+	return __atomic_load_n(pointer, __ATOMIC_ACQUIRE);
+}
+
+static inline void lf_atomic_store_pointer(void **pointer, void *value) {
+	__atomic_store_n(pointer, value, __ATOMIC_RELEASE);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,11 @@
+/** Board oscillator settings */
+#define BOARD_FREQ_SLCK_XTAL        (32768U)
+#define BOARD_FREQ_SLCK_BYPASS      (32768U)
+#define BOARD_FREQ_MAINCK_XTAL      (12000000U)
+#define BOARD_FREQ_MAINCK_BYPASS    (12000000U)
+
+/** Master clock frequency */
+#define BOARD_MCK F_CPU
+
+/** board main clock xtal startup time */
+#define BOARD_OSC_STARTUP_US   15625
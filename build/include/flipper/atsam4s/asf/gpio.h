@@ -0,0 +1 @@
+#include "sam_gpio.h"
@@ -0,0 +1 @@
+#include "interrupt_sam_nvic.h"
@@ -0,0 +1,22 @@
+/* Create an enumeraion defining all of the precomputed identifiers needed for the standard modules. */
+enum {
+	_adc_id,
+	_button_id,
+	_dac_id,
+	_fld_id,
+	_gpio_id,
+	_i2c_id,
+	_led_id,
+	_pwm_id,
+	_rtc_id,
+	_spi_id,
+	_swd_id,
+	_task_id,
+	_temp_id,
+	_timer_id,
+	_uart0_id,
+	_usart_id,
+	_usb_id,
+	_wdt_id,
+};
+/* NOTE: The identifiers in this enumeration must match the order of the module addresses stored in the 'lf_modules' array. */
@@ -0,0 +1,21 @@
+#ifndef __dac_h__
+#define __dac_h__
+
+/* Include all types and macros exposed by the Flipper Toolbox. */
+#include <flipper.h>
+
+/* Declare the virtual interface for this module. */
+extern const struct _dac_interface {
+	int (* configure)(void);
+} dac;
+
+/* Declare the _lf_module structure for this module. */
+extern struct _lf_module _dac;
+
+/* Declare the FMR overlay for this module. */
+enum { _dac_configure };
+
+/* Declare the prototypes for all of the functions within this module. */
+int dac_configure(void);
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef __lf_event_h__
+#define __lf_event_h__
+
+/* Include all types exposed by libflipper. */
+#include <flipper/types.h>
+#include <flipper/lock.h>
+
+typedef uint32_t lf_event_id;
+
+/* The number of slots in the event table when the first event is registered. Must be a power of two. */
+#define LF_EVENT_TABLE_SIZE 16
+
+#include <flipper/observer.h>
+
+typedef struct _lf_event {
+	/* The event's identifier. */
+	lf_event_id id;
+	/* The event's handler function, if any. */
+	void (* handler)(struct _lf_event *event);
+	/* The event info that is to be passed to the event handler. */
+	struct _lf_device *device;
+	/* The event context pointer. */
+	void *ctx;
+	/* The observers subscribed to this event. */
+	lf_observer_list observers;
+} lf_event;
+
+typedef void (* lf_event_handler_func)(lf_event *event);
+
+/* The registered events, found by their identifiers in an open addressed hash table. */
+struct _lf_event_table {
+	/* The events, each in the first free slot at or after the one its identifier hashes to. Empty slots are NULL. */
+	struct _lf_event **slots;
+	/* The number of slots, which is a power of two, and the number of events in them. */
+	uint32_t size;
+	uint32_t count;
+	/* The last identifier handed out by lf_event_generate_unique_id. */
+	lf_event_id last;
+	/* Held while the table is searched or changed. */
+	struct _lf_lock lock;
+};
+
+struct _lf_event *lf_event_create(lf_event_id _id, lf_event_handler_func handler, void *_ctx);
+lf_event_id lf_event_generate_unique_id(void);
+int lf_event_release(lf_event *event);
+lf_event *lf_event_register(lf_event_id id, lf_event_handler_func handler, void *ctx);
+int lf_event_unregister(lf_event *event);
+void *lf_event_finder(void *_event, void *_id);
+struct _lf_event *lf_event_for_id(lf_event_id id);
+int lf_event_subscribe(lf_event *event, struct _lf_device *device);
+int lf_event_trigger(lf_event *event);
+void lf_event_handler(const void *_device, void *_other);
+void lf_handle_events(void);
+void lf_reactor_wake(void);
+
+/* Adds the event to the table. Fails if an event with the same identifier is already in it. */
+int lf_event_table_insert(struct _lf_event_table *table, struct _lf_event *event);
+/* Returns the event with the given identifier, or NULL if there is none. */
+struct _lf_event *lf_event_table_find(struct _lf_event_table *table, lf_event_id id);
+/* Removes the event from the table without releasing it. */
+void lf_event_table_remove(struct _lf_event_table *table, struct _lf_event *event);
+/* Releases every event in the table, and the memory that held them. */
+void lf_event_table_release(struct _lf_event_table *table);
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef __fld_h__
+#define __fld_h__
+
+/* Include all types and macros exposed by the Flipper Toolbox. */
+#include <flipper.h>
+
+/* Declare the virtual interface for this module. */
+extern const struct _fld_interface {
+	int (* configure)(void);
+	int (* index)(lf_crc_t identifier);
+	int (* table)(lf_crc_t *identifiers, lf_size_t length);
+} fld;
+
+/* Declare the FMR overlay for this module. */
+enum { _fld_configure, _fld_index, _fld_table };
+
+/* Declare the _lf_module structure for this module. */
+extern struct _lf_module _fld;
+
+/* Declare the prototypes for all of the functions within this module. */
+int fld_configure(void);
+/* Returns the index of a loaded module. */
+int fld_index(lf_crc_t identifier);
+/* Writes the identifier of each loaded module at its index and returns the number of loaded modules. */
+int fld_table(lf_crc_t *identifiers, lf_size_t length);
+
+#endif
@@ -0,0 +1,396 @@
+/*
+ * libflipper.h
+ *
+ * Core API specifications for interaction with Flipper hardware.
+ *
+ */
+
+#ifndef __libflipper_h__
+#define __libflipper_h__
+
+#include <flipper/types.h>
+
+/* The current version of libflipper. */
+#define LF_VERSION 0x0001
+
+/* If defined, imposes a timeout on USB transactions. */
+#define __lf_usb_timeout__
+#ifdef __lf_usb_timeout__
+/* Must be between 1ms and 255ms. */
+#define LF_USB_TIMEOUT_MS 200
+#else
+#define LF_USB_TIMEOUT_MS 0
+#endif
+
+#define LF_UART_TIMEOUT_MS 100
+
+/* The number of bulk transfers kept in flight by pushes and pulls larger than a single USB packet. */
+#define LF_USB_TRANSFERS 8
+/* The size of each of those transfers. Must be a multiple of the bulk endpoint sizes. */
+#define LF_USB_TRANSFER_SIZE 4096
+/* The number of USB devices that can arrive or leave before the hotplug thread gets to them. Must be a power of two. */
+#define LF_USB_HOTPLUG_EVENTS 64
+
+/* NOTE: Summing the size parameters of each endpoints below should be less than or equal to 160. */
+#define USB_IN_MASK            0x80
+
+#define INTERRUPT_IN_ENDPOINT	(0x01 | USB_IN_MASK)
+#define INTERRUPT_IN_SIZE		16
+#define INTERRUPT_OUT_ENDPOINT	0x02
+#define INTERRUPT_OUT_SIZE		16
+
+#define FMR_INTERFACE			0
+#define BULK_IN_ENDPOINT		(0x01 | USB_IN_MASK)
+#define BULK_IN_SIZE			64
+#define BULK_OUT_ENDPOINT		0x02
+#define BULK_OUT_SIZE			64
+
+#define DEBUG_INTERFACE			1
+#define DEBUG_IN_ENDPOINT		(0x03 | USB_IN_MASK)
+#define DEBUG_IN_SIZE			32
+
+/* The name of the default device to attach to. */
+#define LF_DEFAULT_NAME "flipper"
+
+/* If defined, uses bulk for all USB transfers. */
+#define __ALL_BULK__
+
+enum {
+	LF_DEBUG_LEVEL_OFF,
+	LF_DEBUG_LEVEL_WARNINGS,
+	LF_DEBUG_LEVEL_ERRORS,
+	LF_DEBUG_LEVEL_ALL
+};
+
+//#define __LF_DEBUG__
+#ifdef __LF_DEBUG__
+#define lf_debug(format, ...) printf(format"\n", ##__VA_ARGS__)
+#else
+#define lf_debug(format, ...)
+#endif
+
+/* Sets library debug verbosity. */
+void lf_set_debug_level(int level);
+
+/* Computes the greatest integer from the result of the division of x by y. */
+#define lf_ceiling(x, y) ((x + y - 1) / y)
+
+/* Define bit manipulation macros. */
+#define lo(x) ((uint8_t)(x))
+#define hi(x) ((uint8_t)(x >> 8))
+#define lo16(x) ((uint16_t)(((uint32_t)(x))))
+#define hi16(x) ((uint16_t)(((uint32_t)(x)) >> 16))
+#define little(x) ((((uint16_t)(x)) << 8 ) | (((uint16_t)(x)) >> 8))
+#define little32(x) ((((uint32_t)(x)) << 16 ) | (((uint32_t)(x)) >> 16))
+
+#include <flipper/error.h>
+#include <flipper/fmr.h>
+#include <flipper/lock.h>
+#include <flipper/vector.h>
+
+/* Macros that quantify device attributes. */
+#define lf_device_8bit (1 << 1)
+#define lf_device_16bit (1 << 2)
+#define lf_device_32bit (1 << 3)
+#define lf_device_big_endian    1
+#define lf_device_little_endian 0
+
+/* Macros that quantify the protocol features a device supports. */
+#define lf_capability_unchecked (1 << 0)
+#define lf_capability_batch (1 << 1)
+#define lf_capability_inline (1 << 2)
+#define lf_capability_deferred (1 << 3)
+#define lf_capability_compression (1 << 4)
+#define lf_capability_modules (1 << 5)
+
+/* Standardizes a way to obtain the name, version, attributes, and capabilities of a Flipper device. */
+struct LF_PACKED _lf_configuration {
+	/* The human readable name of the device. */
+	char name[16];
+	/* An identifier unique to the device. */
+	lf_crc_t identifier;
+	/* The device's firmware version. */
+	lf_version_t version;
+	/* The attributes of the device. 3 (attach by default), 2:1 (word length), 0 (endianness) */
+	uint8_t attributes;
+	/* The size of the largest frame that the device accepts. */
+	uint16_t frame_size;
+	/* The maximum number of packets that may be sent to the device before its results are retrieved. */
+	uint8_t window;
+	/* The protocol features that the device supports. 5 (modules), 4 (compression), 3 (deferred), 2 (inline), 1 (batch), 0 (unchecked) */
+	uint8_t capabilities;
+	/* The frequency of the device's clock in hertz. */
+	uint32_t clock;
+};
+
+/* The configuration that a device reports to the host. Defined by each platform. */
+extern struct _lf_configuration fmr_configuration;
+
+/* The maximum number of invocations that can be outstanding on a single device. */
+#define LF_MAX_OUTSTANDING 16
+/* The number of packets sent without a reply after which the device is synced. */
+#define LF_MAX_UNSYNCED 64
+/* The number of user modules whose identifiers are cached for each device. */
+#define LF_MAX_MODULES 16
+/* The number of modules that a device's selector can route. */
+#define LF_MAX_ROUTES 24
+
+#if defined(__AVR__)
+/* The number of messages that are preallocated for the asynchronous message path. */
+#define LF_MSG_POOL_SIZE 4
+/* The number of events, observers, arguments and list nodes that are preallocated. */
+#define LF_EVENT_POOL_SIZE 1
+#define LF_OBSERVER_POOL_SIZE 1
+#define LF_ARG_POOL_SIZE 2
+#define LF_LL_POOL_SIZE 2
+/* Whether objects are taken from the heap once their pool is exhausted. There is too little RAM to preallocate for the worst case. */
+#define LF_SLAB_OVERFLOW true
+/* The number of messages each of an endpoint's queues can hold. Must be a power of two. */
+#define LF_ENDPOINT_QUEUE_SIZE 4
+#elif defined(ATSAM4S)
+#define LF_MSG_POOL_SIZE 32
+#define LF_EVENT_POOL_SIZE 16
+#define LF_OBSERVER_POOL_SIZE 16
+#define LF_ARG_POOL_SIZE 64
+#define LF_LL_POOL_SIZE 64
+/* The heap is shared with the stacks of every task, so an exhausted pool fails rather than eat into it. */
+#define LF_SLAB_OVERFLOW false
+#define LF_ENDPOINT_QUEUE_SIZE 64
+#else
+#define LF_MSG_POOL_SIZE 128
+#define LF_EVENT_POOL_SIZE 64
+#define LF_OBSERVER_POOL_SIZE 64
+#define LF_ARG_POOL_SIZE 256
+#define LF_LL_POOL_SIZE 256
+#define LF_SLAB_OVERFLOW true
+#define LF_ENDPOINT_QUEUE_SIZE 64
+#endif
+
+/* The states that an invocation's completion can be in. */
+enum {
+	/* The completion is not tracking an invocation. */
+	lf_completion_free,
+	/* The invocation has been sent, but its result has not yet been retrieved. */
+	lf_completion_pending,
+	/* The result has been retrieved, but has not yet been awaited. */
+	lf_completion_done
+};
+
+/* Tracks an invocation that has been sent to a device until its result is awaited. */
+struct _lf_completion {
+	/* The device to which the invocation was sent. */
+	struct _lf_device *device;
+	/* The sequence number of the packet that carried the invocation. */
+	uint8_t sequence;
+	/* The state of the completion. */
+	uint8_t state;
+	/* The result of the invocation. Valid once the completion is done. */
+	struct _fmr_result result;
+};
+
+/* Directs invocations of a module that has no device of its own to the device and index that serve it. */
+struct _lf_route {
+	struct _lf_module *module;
+	struct _lf_device *device;
+	int index;
+};
+
+/* Describes a device capible of responding to FMR packets. */
+struct _lf_device {
+	struct _lf_configuration configuration;
+	/* A pointer to the endpoint through which packets will be transferred. */
+	struct _lf_endpoint *endpoint;
+	/* The device's selector function. Routes the modules that the device serves. Called once, when the device is attached. */
+	int (* select)(struct _lf_device *device);
+	/* The device's destructor. */
+	int (* destroy)(struct _lf_device *device);
+	/* The device's context. */
+	void *_ctx;
+	/* The current error state of the device. */
+	lf_error_t error;
+	/* The sequence number that will be given to the next packet sent to the device. */
+	uint8_t sequence;
+	/* The maximum number of invocations that may be outstanding on the device at once. */
+	uint8_t window;
+	/* The number of invocations whose results have not yet been retrieved from the device. */
+	uint8_t outstanding;
+	/* Tracks the invocations that have been sent to the device. */
+	struct _lf_completion completions[LF_MAX_OUTSTANDING];
+	/* The size of the largest frame that the device accepts. */
+	uint16_t frame_size;
+	/* If set, invocations of functions returning 'lf_void_t' are sent without waiting for a reply. */
+	uint8_t deferred;
+	/* The number of packets sent without a reply since the device was last synced. */
+	uint8_t unsynced;
+	/* The failure of a packet sent without a reply, collected before 'lf_sync' was called, that it has yet to report. */
+	lf_error_t unreported;
+	/* Set when the results of abandoned invocations may still arrive. Data pulled in a transfer of its own cannot be told apart from them, so they are skipped first. */
+	uint8_t stale;
+	/* The identifiers of the user modules loaded on the device, indexed by the position of each module. */
+	lf_crc_t modules[LF_MAX_MODULES];
+	/* The number of user modules loaded on the device, or -1 if they have not been retrieved since the last load. */
+	int16_t module_count;
+	/* The user modules found on the device, so that each is looked up once rather than on every call. Forgotten when an image is loaded. */
+	struct _lf_route located[LF_MAX_MODULES];
+	uint8_t located_count;
+	/* The number of images loaded onto the device. A lookup that spans a load is not remembered. */
+	uint8_t loads;
+	/* The routes filled in by the device's selector. Not changed once the device has been attached. */
+	struct _lf_route routes[LF_MAX_ROUTES];
+	uint8_t route_count;
+	/* Held while a thread is exchanging packets with the device, so that the exchanges of different threads do not interleave. */
+	struct _lf_lock lock;
+	/* The number of references to the device. Its creator and then the attached devices hold one, as does each call in progress on it. */
+	uint32_t references;
+};
+
+typedef struct _lf_event_table lf_event_list;
+extern lf_event_list lf_registered_events;
+#define lf_get_event_list() lf_registered_events
+
+typedef struct _lf_vector lf_device_list;
+extern lf_device_list lf_attached_devices;
+/* Held while the list of attached devices is changed or walked. */
+extern struct _lf_lock lf_attached_lock;
+
+/* The device selected most recently by any thread. */
+extern struct _lf_device *lf_current_device;
+/* Selects the device for the calling thread. */
+void lf_set_current_device(struct _lf_device *device);
+/* Selects the device for the calling thread, without changing the device that other threads fall back to. Returns the thread's previous selection. */
+struct _lf_device *lf_set_thread_device(struct _lf_device *device);
+/* Returns the device selected by the calling thread, or by any thread if it has selected none. */
+struct _lf_device *lf_get_current_device(void);
+
+/* Standardizes the notion of a module. */
+struct _lf_module {
+	/*! A string containing the module's name. */
+	const char *name;
+	/*! A string giving the description of a module. */
+	const char *description;
+	/*! The version of the module. */
+	lf_version_t version;
+	/*! The module's identifier. */
+	lf_crc_t identifier;
+	/*! The module's loaded index, or -1 if it is found on each device when invoked. */
+	int index;
+	/*! The device upon which the module's counterpart is located, or NULL if it is invoked on the current device. */
+	struct _lf_device *device;
+	/*! The module's binary data. */
+	void *data;
+	/*! The binary data size. */
+	uint32_t *psize;
+};
+
+/* Macro for easily generating module structures. */
+#define LF_MODULE(symbol, name, description, pdata, plen) \
+	struct _lf_module symbol = { \
+		name, \
+		description, \
+		LF_VERSION, \
+		0, \
+		-1, \
+		NULL, \
+		pdata, \
+		plen \
+	};
+
+/* Used by selectors. Routes the module to the given device and index on the device being selected. */
+#define LF_MODULE_SET_DEVICE_AND_ID(module, _device, _id) lf_route(&module, _device, _id);
+
+/* Routes invocations of the module made through the device whose selector is running. */
+void lf_route(struct _lf_module *module, struct _lf_device *device, int index);
+/* Finds the device and index through which the module is invoked, relative to 'device' or the current device if NULL. The module is not changed. The device is retained, and must be released once the call is done with it. */
+struct _lf_device *lf_resolve(struct _lf_module *module, struct _lf_device *device, int *index);
+
+struct _lf_device *lf_device_create(struct _lf_endpoint *endpoint, int (* select)(struct _lf_device *device), int (* destroy)(struct _lf_device *device), size_t context_size);
+/* Takes a reference to the device, so that it is not released while it is in use. */
+struct _lf_device *lf_device_retain(struct _lf_device *device);
+/* Drops a reference to the device, releasing it once there are none left. */
+int lf_device_release(struct _lf_device *device);
+
+/* Attaches to a device. */
+int lf_attach(struct _lf_device *device);
+int lf_detach(struct _lf_device *device);
+int lf_select(struct _lf_device *device);
+/* Sets the number of invocations that may be outstanding on the device at once. */
+int lf_set_window(struct _lf_device *device, uint8_t window);
+/* Sets whether invocations returning 'lf_void_t' are sent without waiting for a reply. Their errors are reported by 'lf_sync'. */
+int lf_set_deferred(struct _lf_device *device, bool deferred);
+
+#include <flipper/endpoint.h>
+#include <flipper/ll.h>
+
+/* Performs a remote procedure call to a module's function. */
+lf_return_t lf_invoke(struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *args);
+/* Sends a remote procedure call to a module's function without waiting for its result. */
+struct _lf_completion *lf_invoke_async(struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *args);
+/* Waits for the result of an asynchronous invocation and releases its completion. */
+lf_return_t lf_await(struct _lf_completion *completion);
+/* Accumulates invocations that are to be sent to a device in a single packet. */
+struct _lf_batch {
+	/* The device to which the batch will be sent. */
+	struct _lf_device *device;
+	/* The packet into which the invocations are encoded. */
+	struct _fmr_packet packet;
+};
+
+/* Begins a new batch of invocations for the given device. */
+int lf_batch_begin(struct _lf_batch *batch, struct _lf_device *device);
+/* Appends a remote procedure call to a module's function to the batch. */
+int lf_batch_add(struct _lf_batch *batch, struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *args);
+/* Sends the batch to its device and retrieves the result of each invocation. */
+int lf_batch_commit(struct _lf_batch *batch, struct _fmr_result *results);
+
+/* Moves data from the address space of the host to that of the device. */
+lf_return_t lf_push(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _fmr_args *args);
+/* Moves data from the address space of the device to that of the host. */
+lf_return_t lf_pull(struct _lf_module *module, lf_function function, void *destination, lf_size_t length, struct _fmr_args *args);
+
+/* Variants of the calls above that take an argument list. Used by the language bindings. */
+lf_return_t lf_invoke_ll(struct _lf_module *module, lf_function function, lf_type ret, struct _lf_ll *args);
+lf_return_t lf_push_ll(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _lf_ll *args);
+lf_return_t lf_pull_ll(struct _lf_module *module, lf_function function, void *destination, lf_size_t length, struct _lf_ll *args);
+
+/* Closes the library. */
+int lf_exit(void);
+
+/* Load the device's configuration information. */
+int lf_load_configuration(struct _lf_device *device);
+/* Provides a checksum for a given block of data. */
+lf_crc_t lf_crc(const void *source, size_t length);
+/* Continues a checksum over a block of data in software. */
+lf_crc_t lf_crc_update(lf_crc_t crc, const void *source, size_t length);
+
+/* Obtains the result of the packet with the given sequence number from a device, failing if the result reports an error. */
+int lf_get_result(struct _lf_device *device, uint8_t sequence, struct _fmr_result *result);
+/* Pulls the reply to the packet with the given sequence number, which begins with its result, skipping the late results of abandoned invocations. */
+int lf_retrieve_reply(struct _lf_device *device, uint8_t sequence, void *reply, lf_size_t length);
+/* Sends a sync and retrieves its reply, skipping the late results before it. Keeps the failure it reports for 'lf_sync'. */
+int lf_exchange_sync(struct _lf_device *device, struct _fmr_result *result);
+/* Sends a packet to the specified device. */
+int lf_transfer(struct _lf_device *device, struct _fmr_packet *packet);
+/* Retrieves a packet from the specified device. */
+int lf_retrieve(struct _lf_device *device, struct _fmr_result *response);
+/* Retrieves the next result from the device and files it under the invocation waiting for it. */
+bool lf_complete(struct _lf_device *device, struct _fmr_result *result);
+int lf_retrieve_completion(struct _lf_device *device);
+/* Retrieves the results of all of the invocations outstanding on the device. */
+int lf_drain(struct _lf_device *device);
+/* Waits until the device has performed every packet sent to it, and reports the failure of any sent without a reply. */
+int lf_sync(struct _lf_device *device);
+/* Binds a module structure to its device counterpart. Must be done before the module is shared between threads. */
+int lf_bind(struct _lf_module *module, struct _lf_device *device);
+/* Retrieves the identifiers of all of the user modules loaded on the device in a single call. */
+int lf_load_modules(struct _lf_device *device);
+/* Finds the index of a user module on the device from its identifier, or returns -1 if it is not loaded. */
+int lf_module_index(struct _lf_device *device, lf_crc_t identifier);
+
+/* Experimental: Load an application into RAM and execute it. */
+int lf_load(void *source, lf_size_t length, struct _lf_device *device);
+
+/* Prints verbose information about the packet disassembly. */
+void lf_debug_packet(struct _fmr_packet *packet, size_t length);
+void lf_debug_result(struct _fmr_result *result);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef __lf_message_h__
+#define __lf_message_h__
+
+#include <flipper/types.h>
+#include <flipper/event.h>
+#include <flipper/fmr.h>
+
+typedef enum {
+	lf_msg_rpc_kind,
+	lf_msg_event_kind,
+} lf_msg_kind;
+
+/* A message with intent to modify device state. */
+struct _lf_msg {
+	/* The raw data conveyed by the message. */
+	void *_raw;
+	/* The size of the raw data conveyed by the message. */
+	/* The kind of message. */
+	lf_msg_kind kind;
+	/* The outgoing message's number. */
+	int message_number;
+	/* The receipt event id. */
+	lf_event_id event_id;
+};
+
+/* A message as it is sent over an endpoint. Carried by an 'fmr_event_class' packet that expects no result, so that it can arrive among results. */
+struct LF_PACKED _fmr_message_packet {
+	/* The packet header programmed with 'fmr_event_class'. */
+	struct _fmr_header header;
+	/* The kind of message. */
+	uint8_t kind;
+	/* The message's number. */
+	int32_t message_number;
+	/* The receipt event id. */
+	lf_event_id event_id;
+};
+
+struct _lf_msg *lf_msg_create(lf_msg_kind kind);
+void lf_msg_release(struct _lf_msg *msg);
+int lf_msg_send(struct _lf_msg *msg, struct _lf_endpoint *endpoint);
+int lf_msg_subscribe_receipt(struct _lf_msg *msg, lf_event_handler_func callback);
+int lf_msg_send_async(struct _lf_msg *msg, struct _lf_endpoint *endpoint, lf_event_handler_func callback);
+int lf_msg_apply(struct _lf_msg *msg);
+bool lf_msg_framed(const struct _fmr_packet *packet);
+int lf_msg_receive(struct _lf_endpoint *endpoint, const struct _fmr_packet *packet);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef __lf_observer_h__
+#define __lf_observer_h__
+
+#include <flipper/types.h>
+#include <flipper/vector.h>
+
+typedef struct _lf_vector lf_observer_list;
+
+#include <flipper/event.h>
+#include <flipper/endpoint.h>
+
+struct _lf_observer {
+	/* The event id which this observer is subscribed to. */
+	lf_event_id event_id;
+	/* The endpoint over which the observer is to be notified. */
+	struct _lf_endpoint *endpoint;
+};
+
+struct _lf_observer *lf_observer_create(lf_event_id _id, struct _lf_endpoint *_endpoint);
+int lf_observer_release(struct _lf_observer *observer);
+int lf_observer_register(struct _lf_endpoint *endpoint, lf_event_id id);
+void lf_observer_notify(const void *_observer, void *_unused);
+
+#endif
@@ -0,0 +1,22 @@
+/* reactor.h - Waits for data across the endpoints of all attached devices. */
+
+#ifndef __lf_reactor_h__
+#define __lf_reactor_h__
+
+#include <flipper.h>
+
+/* How often devices whose endpoints cannot be waited on are polled, in milliseconds. */
+#define LF_REACTOR_POLL_MS 10
+/* The most file descriptors that a single endpoint can be waited on through. */
+#define LF_REACTOR_MAX_DESCRIPTORS 16
+/* The most ready descriptors handled per wakeup. */
+#define LF_REACTOR_MAX_EVENTS 64
+
+/* Starts waiting on the device's endpoint, or polling it if it cannot be waited on. */
+int lf_reactor_register(struct _lf_device *device);
+/* Stops waiting on the device's endpoint. */
+int lf_reactor_unregister(struct _lf_device *device);
+/* Waits up to 'timeout' milliseconds, or forever if negative, and handles the devices that have data. Returns how many were handled. */
+int lf_reactor_poll(int timeout);
+
+#endif
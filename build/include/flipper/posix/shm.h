@@ -0,0 +1,68 @@
+/* shm.h - Define and implement the shared memory endpoint. */
+
+#ifndef __lf_shm_h__
+#define __lf_shm_h__
+
+#include <flipper.h>
+
+/* The default name of the shared memory region used to reach a device in another process. */
+#define LF_SHM_NAME "/flipper"
+/* The size of each ring. Must be a power of two. */
+#define LF_SHM_RING_SIZE (64 * 1024)
+/* The number of times a ring is checked before waiting on it puts the caller to sleep. */
+#define LF_SHM_SPIN 4096
+/* How long a host waits to hear from a device before a pull fails. */
+#define LF_SHM_TIMEOUT_MS 5000
+/* Identifies a region that has been set up by a device. */
+#define LF_SHM_MAGIC 0x666c6970
+
+/* A single producer, single consumer ring of bytes. Each message is preceded by its 32-bit length. */
+struct _lf_shm_ring {
+	/* The number of bytes ever written, and whether the producer is asleep waiting for space. Only written by the producer. */
+	uint32_t head __attribute__((aligned(64)));
+	uint32_t full;
+	/* The number of bytes ever read, and whether the consumer is asleep waiting for data. Only written by the consumer. */
+	uint32_t tail __attribute__((aligned(64)));
+	uint32_t empty;
+	uint8_t data[LF_SHM_RING_SIZE] __attribute__((aligned(64)));
+};
+
+/* The layout of the shared memory region. */
+struct _lf_shm_region {
+	uint32_t magic;
+	/* Incremented each time a host attaches, so that the device can tell that it is talking to a new host. */
+	uint32_t session;
+	/* Where the messages of the latest host start in the first ring. */
+	uint32_t start;
+	/* The first ring carries messages from the host to the device, and the second carries the replies. */
+	struct _lf_shm_ring rings[2];
+};
+
+struct _lf_shm_context {
+	struct _lf_shm_region *region;
+	/* The ring messages are pushed into, and the ring they are pulled from. */
+	struct _lf_shm_ring *out;
+	struct _lf_shm_ring *in;
+	/* The session this endpoint belongs to. */
+	uint32_t session;
+	/* How long a pull waits to hear from the peer, in milliseconds. Zero waits forever. */
+	uint32_t timeout;
+	/* The number of times a ring is checked before waiting on it puts the caller to sleep. */
+	uint32_t spin;
+	/* Set if this endpoint created the region, and so removes it when destroyed. */
+	bool owner;
+	char name[64];
+};
+
+int lf_shm_configure(struct _lf_endpoint *endpoint, void *_ctx);
+bool lf_shm_ready(struct _lf_endpoint *endpoint);
+int lf_shm_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length);
+int lf_shm_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length);
+int lf_shm_destroy(struct _lf_endpoint *endpoint);
+
+/* Creates a shared memory region with the given name, and returns the device's endpoint for it. */
+struct _lf_endpoint *lf_shm_endpoint_create(char *name);
+/* Returns the endpoint for a device that is served over the shared memory region with the given name. */
+struct _lf_endpoint *lf_shm_endpoint_for_name(char *name);
+
+#endif
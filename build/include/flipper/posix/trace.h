@@ -0,0 +1,73 @@
+/* trace.h - Define and implement endpoints that record the traffic of another endpoint, and that replay it. */
+
+#ifndef __lf_trace_h__
+#define __lf_trace_h__
+
+#include <flipper.h>
+
+/* If set, the traffic of every attached device is recorded to the file it names. Devices after the first get '.1', '.2', ... appended. */
+#define LF_RECORD_ENV "LF_RECORD"
+
+/* 'LFTR' in a little endian file. */
+#define LF_TRACE_MAGIC 0x5254464c
+#define LF_TRACE_VERSION 1
+
+/* A trace is a header followed by one record per transfer. Fields are in host byte order. */
+struct LF_PACKED _lf_trace_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+};
+
+enum { lf_trace_push, lf_trace_pull };
+
+/* Followed by 'length' bytes: the data pushed, or the data pulled. A failed pull carries no data. */
+struct LF_PACKED _lf_trace_record {
+	/* The microseconds since the previous record, or since the trace began. */
+	uint32_t delta;
+	uint8_t kind;
+	/* The error that the transfer failed with, or E_OK. */
+	uint8_t error;
+	uint32_t length;
+};
+
+struct _lf_record_context {
+	/* The endpoint whose traffic is recorded. Released along with the recorder. */
+	struct _lf_endpoint *endpoint;
+	FILE *file;
+	/* When the last record was written, in microseconds. */
+	uint64_t last;
+};
+
+struct _lf_replay_context {
+	/* The whole trace, and how far into it the replay has got. */
+	uint8_t *trace;
+	size_t size;
+	size_t cursor;
+	/* The number of pushes whose data differed from the trace, and records skipped to stay in step with the host. */
+	uint64_t differed;
+	uint64_t skipped;
+	char path[256];
+};
+
+int lf_record_configure(struct _lf_endpoint *endpoint, void *_ctx);
+bool lf_record_ready(struct _lf_endpoint *endpoint);
+int lf_record_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length);
+int lf_record_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length);
+int lf_record_destroy(struct _lf_endpoint *endpoint);
+int lf_record_descriptors(struct _lf_endpoint *endpoint, int *fds, int count);
+
+int lf_replay_configure(struct _lf_endpoint *endpoint, void *_ctx);
+bool lf_replay_ready(struct _lf_endpoint *endpoint);
+int lf_replay_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length);
+int lf_replay_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length);
+int lf_replay_destroy(struct _lf_endpoint *endpoint);
+
+/* Returns an endpoint that passes transfers on to the given endpoint, and records them to the file at 'path'. */
+struct _lf_endpoint *lf_record_endpoint_for_endpoint(struct _lf_endpoint *endpoint, const char *path);
+/* Wraps the endpoint in a recorder if LF_RECORD_ENV is set. Otherwise, returns the endpoint unchanged. */
+struct _lf_endpoint *lf_record_endpoint_from_env(struct _lf_endpoint *endpoint);
+/* Returns an endpoint that answers pulls with the data recorded in the trace at 'path', without any I/O. */
+struct _lf_endpoint *lf_replay_endpoint_for_path(const char *path);
+
+#endif
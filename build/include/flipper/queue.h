@@ -0,0 +1,36 @@
+/* queue.h - A bounded queue that any number of threads can push to and pop from without a lock. */
+
+#ifndef __lf_queue_h__
+#define __lf_queue_h__
+
+#include <flipper/types.h>
+
+/* A slot in the queue. Its sequence tells pushes and pops whose turn it is to use the slot. */
+struct _lf_queue_cell {
+	uint32_t sequence;
+	void *item;
+};
+
+struct _lf_queue {
+	/* One less than the number of cells, which must be a power of two. */
+	uint32_t mask;
+	/* The number of items ever pushed and popped. */
+	uint32_t head;
+	uint32_t tail;
+	struct _lf_queue_cell *cells;
+};
+
+/* Prepares an empty queue that uses the given cells. */
+void lf_queue_init(struct _lf_queue *queue, struct _lf_queue_cell *cells, uint32_t size);
+/* Allocates an empty queue that can hold 'size' items. */
+struct _lf_queue *lf_queue_create(uint32_t size);
+/* Appends the item to the queue. Returns false if the queue is full. */
+bool lf_queue_push(struct _lf_queue *queue, void *item);
+/* Removes the oldest item from the queue. Returns NULL if the queue is empty. */
+void *lf_queue_pop(struct _lf_queue *queue);
+/* Returns true if nothing is waiting in the queue. A push that is under way is not seen until it returns, so a consumer that sleeps while the queue is empty must be woken by pushers after they push. */
+bool lf_queue_empty(struct _lf_queue *queue);
+/* Frees a queue returned by lf_queue_create. Items still in the queue are not released. */
+void lf_queue_release(struct _lf_queue *queue);
+
+#endif
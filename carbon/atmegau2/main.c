@@ -11,7 +11,7 @@ void loop(void) {
 	while (1) {
 
 		struct _fmr_packet packet;
-		struct _fmr_result result;
+		struct _fmr_reply reply;
 
 		int _e = megausb_bulk_receive(&packet, sizeof(struct _fmr_packet));
 
@@ -19,8 +19,14 @@ void loop(void) {
 
 		if (_e == lf_success) {
 			lf_error_clear();
-			fmr_perform(&packet, &result);
-			megausb_bulk_transmit(&result, sizeof(struct _fmr_result));
+			lf_size_t size = fmr_perform(&packet, &reply);
+			if (packet.header.type == fmr_configuration_class && size > sizeof(struct _fmr_result)) {
+				/* The host reads the configuration separately from its result, so it is sent in a transfer of its own. */
+				megausb_bulk_transmit(&reply.result, sizeof(struct _fmr_result));
+				megausb_bulk_transmit(reply.data, size - sizeof(struct _fmr_result));
+			} else if (size) {
+				megausb_bulk_transmit(&reply, size);
+			}
 		}
 
 		wdt_reset();
@@ -1,6 +1,18 @@
 #include <flipper.h>
 #include <flipper/atmegau2/megausb.h>
 
+/* USB detects corrupted transfers and holds off the host while a packet is performed. */
+struct _lf_configuration fmr_configuration = {
+	"flipper",
+	0,
+	LF_VERSION,
+	lf_device_8bit | lf_device_little_endian,
+	FMR_MAX_PACKET_SIZE,
+	1,
+	lf_capability_unchecked | lf_capability_batch | lf_capability_inline | lf_capability_deferred,
+	F_CPU
+};
+
 lf_return_t fmr_push(struct _fmr_push_pull_packet *packet) {
 	int retval;
 	void *swap = malloc(packet->length);
@@ -28,3 +40,13 @@ lf_return_t fmr_pull(struct _fmr_push_pull_packet *packet) {
 	free(swap);
 	return retval;
 }
+
+lf_return_t fmr_batch(struct _fmr_batch_packet *packet) {
+	struct _fmr_result results[FMR_MAX_BATCH];
+	memset(results, 0, sizeof(results));
+	lf_size_t count = (packet->count < FMR_MAX_BATCH) ? packet->count : FMR_MAX_BATCH;
+	int performed = fmr_execute_batch(packet, results);
+	/* The host always expects one result per invocation in the batch. */
+	megausb_bulk_transmit(results, count * sizeof(struct _fmr_result));
+	return performed;
+}
@@ -0,0 +1,93 @@
+#include <flipper.h>
+#include <crccu.h>
+
+/* This is the CCITT CRC 16 polynomial. */
+#define POLY 0x1021
+/* Below this length, the slicing tables finish before the CRCCU can be programmed. */
+#define CRCCU_MIN_LENGTH 256
+/* The largest number of bytes a single CRCCU descriptor can transfer. */
+#define CRCCU_MAX_TRANSFER 0xFFFF
+
+/* The CRCCU descriptor must be aligned to a 512 byte boundary. */
+crccu_dscr_type_t crccu_descriptor __attribute__((aligned(512)));
+/* The value the CRCCU starts from after it is reset. */
+uint16_t crccu_seed;
+/* Zero until the CRCCU has been checked against the software CRC, then 1 if it agrees or -1 if it does not. */
+int8_t crccu_state;
+/* Set while the CRCCU is in use, so that a call from an interrupt falls back to software. */
+volatile uint8_t crccu_busy;
+
+/* Multiplies two polynomials modulo the CCITT polynomial. */
+uint16_t crc_multiply(uint16_t a, uint16_t b) {
+	uint16_t p = 0;
+	for (int8_t i = 15; i >= 0; i --) {
+		p = (p & 0x8000) ? (p << 1 ^ POLY) : (p << 1);
+		if (b & (1 << i)) p ^= a;
+	}
+	return p;
+}
+
+/* Returns what a nonzero seed contributes to the CRC of a buffer of the given length. */
+uint16_t crc_shift(uint16_t seed, size_t length) {
+	/* x^8, the effect of a single byte. */
+	uint16_t power = 0x0100;
+	while (length) {
+		if (length & 1) seed = crc_multiply(seed, power);
+		power = crc_multiply(power, power);
+		length >>= 1;
+	}
+	return seed;
+}
+
+/* Runs the buffer through the CRCCU and returns its raw result. */
+uint16_t crccu_compute(const void *source, size_t length) {
+	const uint8_t *ptr = source;
+	crccu_configure_descriptor(CRCCU, (uintptr_t)&crccu_descriptor);
+	crccu_configure_mode(CRCCU, CRCCU_MR_ENABLE | CRCCU_MR_PTYPE_CCITT16);
+	crccu_reset(CRCCU);
+	/* The CRCCU is not reset between descriptors, so long buffers continue the same CRC. */
+	while (length) {
+		size_t chunk = (length < CRCCU_MAX_TRANSFER) ? length : CRCCU_MAX_TRANSFER;
+		crccu_descriptor.ul_tr_addr = (uintptr_t)ptr;
+		crccu_descriptor.ul_tr_ctrl = chunk | CRCCU_TR_CTRL_TRWIDTH_BYTE | CRCCU_TR_CTRL_IEN_DISABLE;
+		crccu_descriptor.ul_tr_crc = 0;
+		crccu_enable_dma(CRCCU);
+		while (crccu_get_dma_status(CRCCU));
+		ptr += chunk;
+		length -= chunk;
+	}
+	return (uint16_t)crccu_read_crc_value(CRCCU);
+}
+
+/* Clocks the CRCCU and only trusts it if it reproduces the software CRC of a known vector. */
+void crccu_check(void) {
+	const char check[] = "123456789";
+	/* The CRCCU peripheral identifier lives in the second clock enable register. */
+	PMC->PMC_PCER1 = (1 << (ID_CRCCU - 32));
+	uint16_t delta = crccu_compute(check, sizeof(check) - 1) ^ lf_crc_update(0, check, sizeof(check) - 1);
+	crccu_state = 1;
+	if (delta == crc_shift(0xFFFF, sizeof(check) - 1)) {
+		crccu_seed = 0xFFFF;
+	} else if (delta == 0) {
+		crccu_seed = 0;
+	} else {
+		crccu_state = -1;
+	}
+}
+
+lf_crc_t lf_crc(const void *source, size_t length) {
+	if (length < CRCCU_MIN_LENGTH || crccu_busy || crccu_state < 0) {
+		return lf_crc_update(0, source, length);
+	}
+	crccu_busy = 1;
+	if (!crccu_state) crccu_check();
+	lf_crc_t crc;
+	if (crccu_state > 0) {
+		/* Remove the contribution of the seed the CRCCU started from. */
+		crc = crccu_compute(source, length) ^ crc_shift(crccu_seed, length);
+	} else {
+		crc = lf_crc_update(0, source, length);
+	}
+	crccu_busy = 0;
+	return crc;
+}
@@ -8,3 +8,10 @@ int fld_configure(void) {
 int fld_index(lf_crc_t identifier) {
 	return os_get_module_index(identifier);
 }
+
+int fld_table(lf_crc_t *identifiers, lf_size_t length) {
+	for (int i = 0; i < user_modules.count && (i + 1) * sizeof(lf_crc_t) <= length; i ++) {
+		identifiers[i] = user_modules.modules[i].identifier;
+	}
+	return user_modules.count;
+}
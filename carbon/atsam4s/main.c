@@ -5,6 +5,8 @@
 #define CLOCK_TIMEOUT 5000
 
 struct _fmr_packet packet;
+/* Set once the header of the packet has been received and the remainder of the packet is being received. */
+bool packet_body;
 
 extern void uart0_put(uint8_t byte);
 
@@ -68,8 +70,8 @@ int main(void) {
 	gpio_enable(FMR_PIN, 0);
 	gpio_write(0, FMR_PIN);
 
-	/* Pull an FMR packet asynchronously to launch FMR. */
-	uart0_pull(&packet, sizeof(struct _fmr_packet));
+	/* Pull the header of an FMR packet asynchronously to launch FMR. */
+	uart0_pull(&packet, sizeof(struct _fmr_header));
 	/* Enable the PDC receive complete interrupt. */
 	UART0->UART_IER = UART_IER_ENDRX;
 
@@ -86,15 +88,24 @@ void uart0_isr(void) {
 
 	/* If an entire packet has been received, process it. */
 	if (_sr & UART_SR_ENDRX) {
+		/* If only the header has been received, receive the remainder of the packet first. */
+		if (!packet_body && packet.header.magic == FMR_MAGIC_NUMBER && packet.header.length > sizeof(struct _fmr_header) && packet.header.length <= sizeof(struct _fmr_packet)) {
+			packet_body = true;
+			uart0_pull(packet.payload, packet.header.length - sizeof(struct _fmr_header));
+			__enable_irq();
+			return;
+		}
+		packet_body = false;
+
 		gpio_write(FMR_PIN, 0);
 
 		UART0->UART_PTCR = UART_PTCR_RXTDIS | UART_PTCR_TXTDIS;
 
-		struct _fmr_result result;
+		struct _fmr_reply reply;
 		lf_error_clear();
-		fmr_perform(&packet, &result);
-		uart0_push(&result, sizeof(struct _fmr_result));
-		uart0_pull(&packet, sizeof(struct _fmr_packet));
+		lf_size_t size = fmr_perform(&packet, &reply);
+		if (size) uart0_push(&reply, size);
+		uart0_pull(&packet, sizeof(struct _fmr_header));
 
 		/* Wait a bit before raising the FMR pin. */
 		for (size_t i = 0; i < 0x3FF; i ++) __asm__ __volatile__("nop");
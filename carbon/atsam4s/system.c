@@ -5,6 +5,18 @@
 /* Buffer space for incoming message runtime packets. */
 struct _fmr_packet packet;
 
+/* The uart0 link to the U2 has no flow control, so packets are performed one at a time and always checksummed. */
+struct _lf_configuration fmr_configuration = {
+	"flipper",
+	0,
+	LF_VERSION,
+	lf_device_32bit | lf_device_little_endian,
+	FMR_MAX_PACKET_SIZE,
+	1,
+	lf_capability_batch | lf_capability_inline | lf_capability_modules,
+	F_CPU
+};
+
 void uart0_pull_wait(void *destination, lf_size_t length) {
 	/* Disable the PDC receive complete interrupt. */
 	UART0->UART_IDR = UART_IDR_ENDRX;
@@ -61,3 +73,13 @@ lf_return_t fmr_pull(struct _fmr_push_pull_packet *packet) {
 	}
 	return _e;
 }
+
+lf_return_t fmr_batch(struct _fmr_batch_packet *packet) {
+	struct _fmr_result results[FMR_MAX_BATCH];
+	memset(results, 0, sizeof(results));
+	lf_size_t count = (packet->count < FMR_MAX_BATCH) ? packet->count : FMR_MAX_BATCH;
+	int performed = fmr_execute_batch(packet, results);
+	/* The host always expects one result per invocation in the batch. */
+	uart0_push(results, count * sizeof(struct _fmr_result));
+	return performed;
+}
@@ -44,17 +44,37 @@ failure:
 
 int carbon_destroy(struct _lf_device *device);
 
+/* Attaches to a Carbon device over the given endpoint. The endpoint and sub-devices are handed to the new device, and released if it cannot be attached. */
 struct _lf_device *carbon_attach_endpoint(struct _lf_endpoint *endpoint, struct _lf_device *_u2, struct _lf_device *_4s) {
 	/* Create the parent carbon device. */
 	struct _lf_device *carbon = lf_device_create(endpoint, carbon_select, carbon_destroy, sizeof(struct _carbon_context));
+	lf_assert(carbon, failure, E_MALLOC, "Failed to create a Carbon device.");
 	/* Set the 4s's context. */
 	struct _carbon_context *context = carbon->_ctx;
 	/* Set the carbon's u2 and 4s sub-devices. */
 	context->_u2 = _u2;
 	context->_4s = _4s;
-	/* Attach to the new carbon device. */
-	lf_attach(carbon);
+	/* Attach to the new carbon device. Packets addressed to it are handled by the 4S, which reports its own configuration. */
+	int _e = lf_attach(carbon);
+	lf_assert(_e == lf_success, release, E_NO_DEVICE, "Failed to attach to a Carbon device.");
+	if (_4s) {
+		_4s->configuration = carbon->configuration;
+		_4s->frame_size = carbon->frame_size;
+	}
 	return carbon;
+release:
+	/* Releasing the device releases its endpoint and sub-devices along with it. */
+	lf_device_release(carbon);
+	return NULL;
+failure:
+	if (_4s) {
+		/* The 4S shares the endpoint, which is released below. */
+		_4s->endpoint = NULL;
+		lf_device_release(_4s);
+	}
+	lf_device_release(_u2);
+	lf_endpoint_release(endpoint);
+	return NULL;
 }
 
 int uart0_bridge_configure(struct _lf_endpoint *endpoint, void *_configuration) {
@@ -91,17 +111,31 @@ int uart0_bridge_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_
 	return lf_success;
 }
 
-void carbon_attach_to_usb_endpoint_applier(const void *__u2_ep, void *_other) {
-	/* Obtain the u2's endpoint. */
-	struct _lf_endpoint *_u2_ep = (struct _lf_endpoint *)__u2_ep;
+/* Attaches to the Carbon device whose u2 is reached through the given USB endpoint. */
+struct _lf_device *carbon_attach_usb_endpoint(struct _lf_endpoint *_u2_ep) {
 	/* Create the u2 sub-device. */
 	struct _lf_device *_u2 = lf_device_create(_u2_ep, carbon_select_atmegau2, NULL, 0);
+	lf_assert(_u2, failure, E_MALLOC, "Failed to create the bridge of a Carbon device.");
+	/* The u2 is never attached directly, so negotiate with it here. */
+	lf_load_configuration(_u2);
 	/* Create the 4s' endpoint using the u2's uart0 endpoint as a bridge. */
 	struct _lf_endpoint *_4s_ep = lf_endpoint_create(uart0_bridge_configure, uart0_bridge_ready, uart0_bridge_push, uart0_bridge_pull, NULL, 0);
+	lf_assert(_4s_ep, release, E_MALLOC, "Failed to create the bridged endpoint of a Carbon device.");
 	/* Create the 4s sub-device. */
 	struct _lf_device *_4s = lf_device_create(_4s_ep, carbon_select_atsam4s, NULL, 0);
 	/* Attach to a carbon device over the 4s' endpoint. */
-	carbon_attach_endpoint(_4s_ep, _u2, _4s);
+	return carbon_attach_endpoint(_4s_ep, _u2, _4s);
+release:
+	/* Releasing the u2 releases the USB endpoint along with it. */
+	lf_device_release(_u2);
+	return NULL;
+failure:
+	lf_endpoint_release(_u2_ep);
+	return NULL;
+}
+
+void carbon_attach_to_usb_endpoint_applier(const void *__u2_ep, void *_other) {
+	carbon_attach_usb_endpoint((struct _lf_endpoint *)__u2_ep);
 }
 
 /* Attaches to all of the Carbon devices available on the system. */
@@ -113,11 +147,57 @@ int carbon_attach(void) {
 	return lf_success;
 }
 
+/* The application's hotplug callbacks. */
+carbon_hotplug_func carbon_attached;
+carbon_hotplug_func carbon_detached;
+
+int carbon_hotplug_arrived(struct _lf_endpoint *endpoint, void *_ctx) {
+	/* A device that cannot be attached has its endpoint released along with it. */
+	struct _lf_device *carbon = carbon_attach_usb_endpoint(endpoint);
+	if (!carbon) return lf_error;
+	if (carbon_attached) carbon_attached(carbon, _ctx);
+	return lf_success;
+}
+
+int carbon_hotplug_left(struct _lf_endpoint *endpoint, void *_ctx) {
+	/* Find the Carbon device whose u2 was reached through the endpoint. It is retained so that it can be used once the lock is let go. */
+	struct _lf_device *carbon = NULL;
+	lf_lock(&lf_attached_lock);
+	for (uint32_t i = 0; i < lf_vector_count(&lf_attached_devices); i ++) {
+		struct _lf_device *device = lf_vector_item(&lf_attached_devices, i);
+		if (device->select != carbon_select) continue;
+		struct _carbon_context *context = device->_ctx;
+		if (!context->_u2 || context->_u2->endpoint != endpoint) continue;
+		carbon = device;
+		lf_device_retain(carbon);
+		break;
+	}
+	lf_unlock(&lf_attached_lock);
+	if (!carbon) return lf_success;
+	/* The application is told without the lock held, as it may attach, detach or invoke devices itself. */
+	if (carbon_detached) carbon_detached(carbon, _ctx);
+	lf_detach(carbon);
+	/* Releasing the device releases its u2, and the endpoint along with it. */
+	lf_device_release(carbon);
+	return lf_success;
+}
+
+/* Attaches to Carbon devices as they are plugged in, and detaches from them as they are unplugged. */
+int carbon_hotplug(carbon_hotplug_func attached, carbon_hotplug_func detached, void *_ctx) {
+	carbon_attached = attached;
+	carbon_detached = detached;
+	return lf_libusb_hotplug_start(CARBON_USB_VENDOR_ID, CARBON_USB_PRODUCT_ID, carbon_hotplug_arrived, carbon_hotplug_left, _ctx);
+}
+
 int carbon_destroy(struct _lf_device *device) {
 	if (device) {
 		struct _carbon_context *context = (struct _carbon_context *)device->_ctx;
 		lf_device_release(context->_u2);
-		//lf_device_release(context->_4s);
+		if (context->_4s) {
+			/* The 4S shares the endpoint of the Carbon device, which has already been released. */
+			context->_4s->endpoint = NULL;
+			lf_device_release(context->_4s);
+		}
 	}
 	return lf_success;
 }
@@ -130,6 +210,38 @@ failure:
 	return NULL;
 }
 
+struct _lf_device *carbon_attach_tcp(char *hostname) {
+	struct _lf_endpoint *endpoint = lf_tcp_endpoint_for_hostname(hostname);
+	lf_assert(endpoint, failure, E_NO_DEVICE, "Failed to find Carbon device using hostname '%s'.", hostname);
+	return carbon_attach_endpoint(endpoint, NULL, NULL);
+failure:
+	return NULL;
+}
+
+struct _lf_device *carbon_attach_unix(char *path) {
+	struct _lf_endpoint *endpoint = lf_unix_endpoint_for_path(path);
+	lf_assert(endpoint, failure, E_NO_DEVICE, "Failed to find Carbon device at '%s'.", path);
+	return carbon_attach_endpoint(endpoint, NULL, NULL);
+failure:
+	return NULL;
+}
+
+struct _lf_device *carbon_attach_shm(char *name) {
+	struct _lf_endpoint *endpoint = lf_shm_endpoint_for_name(name);
+	lf_assert(endpoint, failure, E_NO_DEVICE, "Failed to find Carbon device sharing '%s'.", name);
+	return carbon_attach_endpoint(endpoint, NULL, NULL);
+failure:
+	return NULL;
+}
+
+struct _lf_device *carbon_attach_replay(char *path) {
+	struct _lf_endpoint *endpoint = lf_replay_endpoint_for_path(path);
+	lf_assert(endpoint, failure, E_NO_DEVICE, "Failed to replay a Carbon device from the trace '%s'.", path);
+	return carbon_attach_endpoint(endpoint, NULL, NULL);
+failure:
+	return NULL;
+}
+
 /* ----------- OLD API ------------ */
 
 /* The Carbon architecture is interesting because we actually have to attach
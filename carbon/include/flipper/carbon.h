@@ -75,9 +75,22 @@ struct _carbon_context {
 	struct _lf_device *_4s;
 };
 
+/* Called with a Carbon device that was plugged in or unplugged. */
+typedef void (* carbon_hotplug_func)(struct _lf_device *device, void *_ctx);
+
 /* Attaches to all carbon devices. */
 int carbon_attach(void);
+/* Attaches to carbon devices as they are plugged in, starting with those already connected, and detaches from them as they are unplugged. The callbacks are called from the thread that watches the USB bus. */
+int carbon_hotplug(carbon_hotplug_func attached, carbon_hotplug_func detached, void *_ctx);
 /* Attaches to a carbon device over the network. */
 struct _lf_device *carbon_attach_hostname(char *hostname);
+/* Attaches to a carbon device over the network using TCP. */
+struct _lf_device *carbon_attach_tcp(char *hostname);
+/* Attaches to a carbon device served by another process on this machine. */
+struct _lf_device *carbon_attach_unix(char *path);
+/* Attaches to a carbon device served over shared memory by another process on this machine. */
+struct _lf_device *carbon_attach_shm(char *name);
+/* Attaches to a carbon device whose answers are replayed from a trace recorded with LF_RECORD. */
+struct _lf_device *carbon_attach_replay(char *path);
 
 #endif
@@ -60,14 +60,14 @@ struct _os_app {
 	struct _os_task *task;
 };
 
-struct _lf_ll *apps;
+/* The applications that have been loaded. */
+struct _lf_vector apps = LF_VECTOR(free);
 
 struct _os_app *get_app(struct _lf_abi_header *header) {
 	char *name = (void *)header + header->name_offset;
 	struct _os_app *app = NULL;
-	int count = lf_ll_count(apps);
-	for (int i = 0; i < count; i ++) {
-		struct _os_app *item = lf_ll_item(apps, i);
+	for (uint32_t i = 0; i < lf_vector_count(&apps); i ++) {
+		struct _os_app *item = lf_vector_item(&apps, i);
 		if (strcmp(name, item->name)) continue;
 		app = item;
 		break;
@@ -79,7 +79,7 @@ void os_app_exit(void *_app) {
 	if (!_app) return;
 	struct _os_app *app = (struct _os_app *)_app;
 	free(app->base);
-	lf_ll_remove(&apps, app);
+	lf_vector_remove(&apps, app);
 }
 
 /* Loads an application into RAM. */
@@ -101,7 +101,7 @@ int os_load_application(void *_base) {
 	lf_assert(task, failure, E_NULL, "Failed to allocate memory for task");
 	app->task = task;
 
-	lf_ll_append(&apps, app, free);
+	lf_vector_append(&apps, app);
 
 	/* Add the task. */
 	os_task_add(task);
@@ -2,9 +2,15 @@
 #include <sys/types.h>
 #include <flipper/usart.h>
 #include <flipper/gpio.h>
+#include <errno.h>
 
+#undef errno
 extern int errno;
 extern int _end;
+extern int _estack;
+
+/* The space kept free below the top of SRAM for the main stack, which exceptions run on. */
+#define OS_MAIN_STACK_SIZE 0x1000
 
 extern caddr_t _sbrk(int increment) {
 	static unsigned char *heap = NULL ;
@@ -16,6 +22,12 @@ extern caddr_t _sbrk(int increment) {
 
 	previous = heap;
 
+	/* Fail the allocation rather than let the heap grow into the main stack. */
+	if (increment > (unsigned char *)&_estack - OS_MAIN_STACK_SIZE - heap) {
+		errno = ENOMEM;
+		return (caddr_t)-1;
+	}
+
 	heap += increment;
 
 	return (caddr_t)(previous);
@@ -0,0 +1,47 @@
+/* link.h - Define and implement an endpoint that emulates a slower, lossier link in front of another endpoint. */
+
+#ifndef __lf_link_h__
+#define __lf_link_h__
+
+#include <flipper.h>
+
+/* If set, every attached device's endpoint is wrapped in a link emulated as described by the variable. */
+#define LF_LINK_ENV "LF_LINK"
+/*
+ * The variable holds comma separated 'key=value' pairs:
+ *   latency    Added to every transfer, in microseconds.
+ *   jitter     The most that is added to the latency at random, in microseconds.
+ *   bandwidth  The bytes per second the link can carry. Zero is unlimited.
+ *   drop       The chance that a transfer is lost, from 0 to 1.
+ *   seed       Seeds the random jitter and drops, so that runs can be repeated.
+ * 'carbon' on its own emulates USB to the U2 and the 1 Mbaud uart0 bridge to the 4S.
+ */
+#define LF_LINK_CARBON "latency=1000,jitter=125,bandwidth=100000"
+
+struct _lf_link_context {
+	/* The endpoint that transfers are passed on to. Released along with the link. */
+	struct _lf_endpoint *endpoint;
+	uint32_t latency;
+	uint32_t jitter;
+	uint32_t bandwidth;
+	double drop;
+	unsigned int seed;
+	/* The number of transfers made and lost, and the total delay added to them in microseconds. */
+	uint64_t transfers;
+	uint64_t dropped;
+	uint64_t delay;
+};
+
+int lf_link_configure(struct _lf_endpoint *endpoint, void *_ctx);
+bool lf_link_ready(struct _lf_endpoint *endpoint);
+int lf_link_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length);
+int lf_link_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length);
+int lf_link_destroy(struct _lf_endpoint *endpoint);
+int lf_link_descriptors(struct _lf_endpoint *endpoint, int *fds, int count);
+
+/* Returns an endpoint that passes transfers on to the given endpoint over a link described as in LF_LINK_ENV. */
+struct _lf_endpoint *lf_link_endpoint_for_endpoint(struct _lf_endpoint *endpoint, const char *description);
+/* Wraps the endpoint if LF_LINK_ENV is set. Otherwise, returns the endpoint unchanged. */
+struct _lf_endpoint *lf_link_endpoint_from_env(struct _lf_endpoint *endpoint);
+
+#endif
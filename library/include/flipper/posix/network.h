@@ -11,10 +11,82 @@
 /* The default port over which FMR can be accessed. */
 #define LF_UDP_PORT 3258
 
+/* The largest payload carried by a single datagram, chosen to fit within a typical MTU. */
+#define LF_NETWORK_SEGMENT_SIZE 1024
+/* The most segments that can be outstanding, and the most received segments that can be buffered. */
+#define LF_NETWORK_MAX_WINDOW 64
+/* The number of segments that are sent before waiting for an acknowledgement, unless configured otherwise. */
+#define LF_NETWORK_WINDOW 32
+/* The retransmission timeout used before the round trip time has been measured, and its bounds. */
+#define LF_NETWORK_RTO_MS 200
+#define LF_NETWORK_MIN_RTO_MS 10
+#define LF_NETWORK_MAX_RTO_MS 2000
+/* The number of times a segment is retransmitted before the peer is considered lost. */
+#define LF_NETWORK_RETRIES 8
+/* The number of duplicate acknowledgements that cause the oldest outstanding segment to be retransmitted. */
+#define LF_NETWORK_DUPLICATES 3
+/* How long a host waits to hear from a device before a pull fails. */
+#define LF_NETWORK_TIMEOUT_MS 5000
+
+/* Set if the segment carries data, and if that data ends a message. Segments without data only acknowledge. */
+#define LF_NETWORK_DATA (1 << 0)
+#define LF_NETWORK_END (1 << 1)
+
+/* Precedes every datagram. Sent in network byte order. */
+struct _lf_network_header {
+	/* Chosen at random by each endpoint, so that a peer can tell when the other end has restarted. */
+	uint32_t session;
+	/* The sequence number of the segment. */
+	uint32_t sequence;
+	/* The sequence number of the next segment the sender expects to receive, acknowledging all before it. */
+	uint32_t ack;
+	/* The number of data bytes that follow the header. */
+	uint16_t length;
+	uint8_t flags;
+	uint8_t reserved;
+};
+
+/* A segment that is outstanding or waiting to be pulled. */
+struct _lf_network_segment {
+	struct _lf_network_header header;
+	uint8_t data[LF_NETWORK_SEGMENT_SIZE];
+	/* When the segment was last sent, in microseconds, and the number of times it has been sent. */
+	uint64_t sent;
+	uint8_t transmissions;
+	/* Set once a received segment is waiting to be pulled. */
+	bool valid;
+};
+
 struct _lf_network_context {
 	int fd;
 	char host[64];
 	struct sockaddr_in device;
+	/* This endpoint's session, and the session of the peer it last heard from. */
+	uint32_t session;
+	uint32_t peer;
+	/* The number of segments that are sent before waiting for an acknowledgement. */
+	uint8_t window;
+	/* How long a pull waits to hear from the peer, in milliseconds. Zero waits forever. */
+	uint32_t timeout;
+	/* The oldest unacknowledged segment, and the next segment to be sent. */
+	uint32_t unacked;
+	uint32_t next;
+	/* The number of duplicate acknowledgements received for the oldest unacknowledged segment. */
+	uint8_t duplicates;
+	/* Set while recovering from a loss, until every segment sent before it was detected has been acknowledged. */
+	bool recovering;
+	uint32_t recover;
+	/* The smoothed round trip time, its variation, and the retransmission timeout, in microseconds. */
+	uint32_t srtt;
+	uint32_t rttvar;
+	uint32_t rto;
+	/* When the oldest unacknowledged segment is retransmitted. */
+	uint64_t deadline;
+	/* The next segment expected from the peer, and the next segment to be pulled. */
+	uint32_t expected;
+	uint32_t consumed;
+	struct _lf_network_segment sent[LF_NETWORK_MAX_WINDOW];
+	struct _lf_network_segment received[LF_NETWORK_MAX_WINDOW];
 };
 
 int lf_network_configure(struct _lf_endpoint *endpoint, void *_ctx);
@@ -22,6 +94,11 @@ bool lf_network_ready(struct _lf_endpoint *endpoint);
 int lf_network_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length);
 int lf_network_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length);
 int lf_network_destroy(struct _lf_endpoint *endpoint);
+int lf_network_descriptors(struct _lf_endpoint *endpoint, int *fds, int count);
+/* Prepares the context of a network endpoint whose socket has been opened. */
+void lf_network_initialize(struct _lf_network_context *context);
+/* Sets the number of segments that are sent before waiting for an acknowledgement. */
+int lf_network_set_window(struct _lf_endpoint *endpoint, uint8_t window);
 struct _lf_endpoint *lf_network_endpoint_for_hostname(char *hostname);
 
 /* Returns the endpoint for a device on the network. */
@@ -0,0 +1,69 @@
+/* pool.h - A pool of worker threads, and calls that are made on every attached device at once through it. */
+
+#ifndef __lf_pool_h__
+#define __lf_pool_h__
+
+#include <flipper.h>
+#include <flipper/queue.h>
+
+#include <pthread.h>
+
+/* The most worker threads the pool will start. Calls fanned out to more devices than this overlap only this many at a time. */
+#define LF_POOL_MAX_THREADS 64
+/* The number of jobs that can be waiting for a worker. Must be a power of two. */
+#define LF_POOL_JOBS 256
+
+/* A unit of work handed to the pool. */
+struct _lf_pool_job {
+	void (* func)(struct _lf_pool_job *job);
+};
+
+struct _lf_pool {
+	/* The jobs waiting for a worker. */
+	struct _lf_queue *jobs;
+	/* Counts the jobs submitted, so that an idle worker can sleep until it changes. */
+	uint32_t submitted;
+	/* The number of workers started, and the number waiting for a job. */
+	uint32_t threads;
+	uint32_t idle;
+	/* Held while the pool is created or grown. */
+	struct _lf_lock lock;
+};
+
+extern struct _lf_pool lf_pool;
+
+/* A call that is made on every attached device. */
+struct _lf_fanout {
+	struct _lf_module *module;
+	lf_function function;
+	lf_type ret;
+	struct _fmr_args *args;
+	/* The data to push, if the call is a push. */
+	void *source;
+	lf_size_t length;
+	bool push;
+	/* The number of devices that have yet to return. */
+	uint32_t remaining;
+};
+
+/* Makes the call on one of the devices. */
+struct _lf_fanout_job {
+	struct _lf_pool_job job;
+	struct _lf_fanout *fanout;
+	struct _lf_device *device;
+	struct _fmr_result *result;
+};
+
+/* Makes sure that the pool has at least 'threads' workers, up to LF_POOL_MAX_THREADS. */
+int lf_pool_reserve(uint32_t threads);
+/* Hands the job to the next idle worker. */
+int lf_pool_submit(struct _lf_pool_job *job);
+
+/* Makes the call on every attached device at once, and waits for all of them. Devices are not attached or detached until it returns. */
+int lf_fanout(struct _lf_fanout *fanout, struct _lf_device **devices, struct _fmr_result *results, int count);
+/* Invokes the function on every attached device at once, and waits for all of them. 'devices' and 'results' must have room for 'count' entries, and are filled in with each device and what it returned. Returns the number of devices. */
+int lf_invoke_all(struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *args, struct _lf_device **devices, struct _fmr_result *results, int count);
+/* Pushes the same data to the module on every attached device at once, as lf_invoke_all. */
+int lf_push_all(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _fmr_args *args, struct _lf_device **devices, struct _fmr_result *results, int count);
+
+#endif
@@ -3,7 +3,13 @@
 #define __lf_platform_h__
 
 #include <unistd.h>
+#include <flipper/posix/link.h>
 #include <flipper/posix/network.h>
+#include <flipper/posix/pool.h>
+#include <flipper/posix/reactor.h>
+#include <flipper/posix/shm.h>
+#include <flipper/posix/stream.h>
+#include <flipper/posix/trace.h>
 #include <flipper/posix/usb.h>
 
 /* Define the modules that this platform uses. */
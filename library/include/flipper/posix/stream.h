@@ -0,0 +1,40 @@
+/* stream.h - Define and implement the TCP and Unix domain socket endpoints. */
+
+#ifndef __lf_stream_h__
+#define __lf_stream_h__
+
+#include <flipper.h>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+
+/* The default port over which FMR can be accessed using TCP. */
+#define LF_TCP_PORT 3258
+/* The default path over which FMR can be accessed by processes on the same machine. */
+#define LF_UNIX_PATH "/tmp/flipper.sock"
+/* How long a host waits to hear from a device before a pull fails. */
+#define LF_STREAM_TIMEOUT_MS 5000
+
+/* Each message is preceded by its length, as a 32-bit integer in network byte order. */
+typedef uint32_t lf_stream_length_t;
+
+struct _lf_stream_context {
+	int fd;
+	char host[108];
+};
+
+int lf_stream_configure(struct _lf_endpoint *endpoint, void *_ctx);
+bool lf_stream_ready(struct _lf_endpoint *endpoint);
+int lf_stream_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length);
+int lf_stream_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length);
+int lf_stream_destroy(struct _lf_endpoint *endpoint);
+int lf_stream_descriptors(struct _lf_endpoint *endpoint, int *fds, int count);
+
+/* Returns an endpoint for a connected stream socket. */
+struct _lf_endpoint *lf_stream_endpoint_for_socket(int fd, char *host);
+/* Returns the endpoint for a device on the network, reached using TCP. */
+struct _lf_endpoint *lf_tcp_endpoint_for_hostname(char *hostname);
+/* Returns the endpoint for a device served by another process on this machine. */
+struct _lf_endpoint *lf_unix_endpoint_for_path(char *path);
+
+#endif
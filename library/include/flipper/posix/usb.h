@@ -4,7 +4,14 @@
 #include <flipper.h>
 #include <flipper/ll.h>
 
+/* Called with the endpoint of a device that has arrived or left. An arrival that fails has released the endpoint, and is not reported as having left. */
+typedef int (* lf_libusb_hotplug_func)(struct _lf_endpoint *endpoint, void *_ctx);
+
 /* Attaches to all devices with a given VID and PID. */
 struct _lf_ll *lf_libusb_endpoints_for_vid_pid(uint16_t vid, uint16_t pid);
+/* Reports devices with a given VID and PID as they are connected and disconnected, starting with those already connected. The endpoint passed to 'arrived' belongs to the callee, and must stay valid until 'left' is called with it. */
+int lf_libusb_hotplug_start(uint16_t vid, uint16_t pid, lf_libusb_hotplug_func arrived, lf_libusb_hotplug_func left, void *_ctx);
+/* Stops reporting devices as they are connected and disconnected. */
+int lf_libusb_hotplug_stop(void);
 
 #endif
@@ -0,0 +1,64 @@
+#include <flipper.h>
+
+/* Other hosts use the slicing tables. The ARMv8 CRC32 instructions only compute the CRC-32 and CRC-32C polynomials, not this 16-bit CRC. */
+#if defined(__x86_64__)
+
+#include <immintrin.h>
+
+/* Below this length the slicing tables are faster than setting up the folding registers. */
+#define LF_CRC_CLMUL_MIN 64
+
+/* Multiplies the upper and lower halves of a block by the folding constants and sums the products. */
+__attribute__((target("pclmul")))
+static inline __m128i lf_crc_fold(__m128i x, __m128i k) {
+	return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00));
+}
+
+/* Folds the buffer sixteen bytes at a time using carry-less multiplication, then finishes the remainder in software. */
+__attribute__((target("pclmul,ssse3")))
+lf_crc_t lf_crc_clmul(const void *source, size_t length) {
+	const __m128i *ptr = source;
+	/* Byte swap each block so that the first byte of the block is its most significant. */
+	const __m128i swap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+	/* x^192 mod P in the upper lane, x^128 mod P in the lower lane. */
+	const __m128i k1 = _mm_set_epi64x(0x650b, 0xaefc);
+	/* x^576 mod P in the upper lane, x^512 mod P in the lower lane. */
+	const __m128i k4 = _mm_set_epi64x(0x8832, 0x13fc);
+	__m128i x = _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap);
+	length -= 16;
+	if (length >= 64) {
+		/* Keep four independent blocks in flight to hide the multiplier latency. */
+		__m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap);
+		__m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap);
+		__m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap);
+		length -= 48;
+		while (length >= 64) {
+			x = _mm_xor_si128(lf_crc_fold(x, k4), _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap));
+			x1 = _mm_xor_si128(lf_crc_fold(x1, k4), _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap));
+			x2 = _mm_xor_si128(lf_crc_fold(x2, k4), _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap));
+			x3 = _mm_xor_si128(lf_crc_fold(x3, k4), _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap));
+			length -= 64;
+		}
+		x = _mm_xor_si128(lf_crc_fold(x, k1), x1);
+		x = _mm_xor_si128(lf_crc_fold(x, k1), x2);
+		x = _mm_xor_si128(lf_crc_fold(x, k1), x3);
+	}
+	while (length >= 16) {
+		x = _mm_xor_si128(lf_crc_fold(x, k1), _mm_shuffle_epi8(_mm_loadu_si128(ptr ++), swap));
+		length -= 16;
+	}
+	/* The folded block is congruent to everything before the tail, so the CRC continues from it. */
+	uint8_t folded[16];
+	_mm_storeu_si128((__m128i *)folded, _mm_shuffle_epi8(x, swap));
+	lf_crc_t crc = lf_crc_update(0, folded, sizeof(folded));
+	return lf_crc_update(crc, ptr, length);
+}
+
+lf_crc_t lf_crc(const void *source, size_t length) {
+	if (length >= LF_CRC_CLMUL_MIN && __builtin_cpu_supports("pclmul")) {
+		return lf_crc_clmul(source, length);
+	}
+	return lf_crc_update(0, source, length);
+}
+
+#endif
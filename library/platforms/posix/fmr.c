@@ -22,7 +22,9 @@ const void *const lf_modules[] = {
 	&wdt
 };
 
-LF_WEAK lf_return_t fmr_call(lf_return_t (* function)(void), lf_type ret, uint8_t argc, uint16_t argt, void *argv) {
+LF_WEAK struct _lf_configuration fmr_configuration;
+
+LF_WEAK lf_return_t fmr_call(lf_return_t (* function)(void), lf_type ret, uint8_t argc, lf_types argt, void *argv) {
 	return -1;
 }
 
@@ -33,3 +35,7 @@ LF_WEAK lf_return_t fmr_push(struct _fmr_push_pull_packet *packet) {
 LF_WEAK lf_return_t fmr_pull(struct _fmr_push_pull_packet *packet) {
 	return -1;
 }
+
+LF_WEAK lf_return_t fmr_batch(struct _fmr_batch_packet *packet) {
+	return -1;
+}
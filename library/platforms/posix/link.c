@@ -0,0 +1,136 @@
+#include <flipper/posix/link.h>
+#include <flipper/error.h>
+#include <flipper.h>
+
+#include <time.h>
+
+int lf_link_configure(struct _lf_endpoint *endpoint, void *_ctx) {
+	struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+	if (!context->endpoint->configure) return lf_success;
+	return context->endpoint->configure(context->endpoint, _ctx);
+}
+
+bool lf_link_ready(struct _lf_endpoint *endpoint) {
+	struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+	if (!context->endpoint->ready) return false;
+	return context->endpoint->ready(context->endpoint);
+}
+
+int lf_link_descriptors(struct _lf_endpoint *endpoint, int *fds, int count) {
+	struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+	return context->endpoint->descriptors(context->endpoint, fds, count);
+}
+
+/* Waits for as long as the link would take to carry a transfer of the given length, and accounts for the wait. */
+void lf_link_delay(struct _lf_link_context *context, lf_size_t length) {
+	uint64_t delay = context->latency;
+	if (context->jitter) delay += rand_r(&context->seed) % (context->jitter + 1);
+	if (context->bandwidth) delay += (uint64_t)length * 1000000 / context->bandwidth;
+	context->transfers ++;
+	if (!delay) return;
+	/* Sleep until an absolute deadline, so that an interrupted sleep does not cut the delay short. */
+	struct timespec deadline;
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += delay / 1000000;
+	deadline.tv_nsec += (delay % 1000000) * 1000;
+	if (deadline.tv_nsec >= 1000000000) {
+		deadline.tv_sec ++;
+		deadline.tv_nsec -= 1000000000;
+	}
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL));
+	context->delay += delay;
+}
+
+/* Returns true if the transfer should be lost. */
+bool lf_link_lost(struct _lf_link_context *context) {
+	if (context->drop <= 0 || (double)rand_r(&context->seed) / RAND_MAX >= context->drop) return false;
+	context->dropped ++;
+	return true;
+}
+
+int lf_link_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+	/* The data has to cross the link before the device sees it. */
+	lf_link_delay(context, length);
+	/* A lost push looks like a successful one to the sender. */
+	if (lf_link_lost(context)) return lf_success;
+	return context->endpoint->push(context->endpoint, source, length);
+}
+
+int lf_link_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+	int _e = context->endpoint->pull(context->endpoint, destination, length);
+	if (_e != lf_success) return _e;
+	lf_link_delay(context, length);
+	lf_assert(!lf_link_lost(context), failure, E_TIMEOUT, "Timed out waiting for data from the emulated link.");
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_link_destroy(struct _lf_endpoint *endpoint) {
+	if (endpoint && endpoint->_ctx) {
+		struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+		/* Report how much the emulated link slowed things down. Only when debugging, so that the report does not mix into the output of the program it wraps. */
+		if (context->transfers) {
+			lf_debug("Emulated link: %llu transfers, %llu lost, %.3f ms of delay added.", (unsigned long long)context->transfers, (unsigned long long)context->dropped, context->delay / 1000.0);
+		}
+		lf_endpoint_release(context->endpoint);
+	}
+	return lf_success;
+}
+
+/* Fills in the link's parameters from its description. */
+int lf_link_parse(struct _lf_link_context *context, const char *description) {
+	if (!strcmp(description, "carbon")) description = LF_LINK_CARBON;
+	char copy[256];
+	lf_assert(strlen(description) < sizeof(copy), failure, E_OVERFLOW, "The description of the emulated link is too long.");
+	strcpy(copy, description);
+	context->seed = 1;
+	char *state;
+	for (char *pair = strtok_r(copy, ",", &state); pair; pair = strtok_r(NULL, ",", &state)) {
+		char *value = strchr(pair, '=');
+		lf_assert(value, failure, E_CONFIGURATION, "Expected 'key=value' in the description of the emulated link, not '%s'.", pair);
+		*value ++ = '\0';
+		if (!strcmp(pair, "latency")) context->latency = strtoul(value, NULL, 0);
+		else if (!strcmp(pair, "jitter")) context->jitter = strtoul(value, NULL, 0);
+		else if (!strcmp(pair, "bandwidth")) context->bandwidth = strtoul(value, NULL, 0);
+		else if (!strcmp(pair, "drop")) context->drop = strtod(value, NULL);
+		else if (!strcmp(pair, "seed")) context->seed = strtoul(value, NULL, 0);
+		else lf_assert(false, failure, E_CONFIGURATION, "Unknown parameter '%s' in the description of the emulated link.", pair);
+	}
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+struct _lf_endpoint *lf_link_endpoint_for_endpoint(struct _lf_endpoint *wrapped, const char *description) {
+	lf_assert(wrapped && description, failure, E_NULL, "Invalid parameter provided to '%s'.", __PRETTY_FUNCTION__);
+	struct _lf_endpoint *endpoint = lf_endpoint_create(lf_link_configure,
+													   lf_link_ready,
+													   lf_link_push,
+													   lf_link_pull,
+													   NULL,
+													   sizeof(struct _lf_link_context));
+	lf_assert(endpoint, failure, E_ENDPOINT, "Failed to create endpoint for emulated link.");
+	struct _lf_link_context *context = (struct _lf_link_context *)endpoint->_ctx;
+	int _e = lf_link_parse(context, description);
+	lf_assert(_e == lf_success, release, E_CONFIGURATION, "Failed to parse the description of the emulated link.");
+	/* The link owns the wrapped endpoint only once it has been set up. */
+	context->endpoint = wrapped;
+	endpoint->destroy = lf_link_destroy;
+	if (wrapped->descriptors) endpoint->descriptors = lf_link_descriptors;
+	return endpoint;
+release:
+	lf_endpoint_release(endpoint);
+failure:
+	return NULL;
+}
+
+struct _lf_endpoint *lf_link_endpoint_from_env(struct _lf_endpoint *endpoint) {
+	const char *description = getenv(LF_LINK_ENV);
+	if (!description || !*description) return endpoint;
+	struct _lf_endpoint *link = lf_link_endpoint_for_endpoint(endpoint, description);
+	/* Carry on over the real link rather than fail to attach. */
+	return (link) ? link : endpoint;
+}
@@ -0,0 +1,31 @@
+#include <flipper.h>
+#include <flipper/lock.h>
+
+#if defined(__linux__)
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+void lf_lock_wait(uint32_t *word, uint32_t value) {
+	/* Returns early if the word has already changed, or on a signal. The caller checks the lock again either way. */
+	syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+void lf_lock_wake(uint32_t *word) {
+	syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+#else
+
+#include <sched.h>
+
+void lf_lock_wait(uint32_t *word, uint32_t value) {
+	/* Give the holder of the lock a chance to release it. */
+	sched_yield();
+}
+
+void lf_lock_wake(uint32_t *word) {
+
+}
+
+#endif
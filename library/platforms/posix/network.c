@@ -2,19 +2,247 @@
 #include <flipper/error.h>
 #include <flipper.h>
 
+#include <poll.h>
+#include <sys/uio.h>
+#include <time.h>
+
+/* Compares sequence numbers, allowing them to wrap around. */
+#define lf_network_before(a, b) ((int32_t)((a) - (b)) < 0)
+
+/* Returns a monotonic time in microseconds. */
+uint64_t lf_network_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/* Forgets everything sent to and received from the peer. */
+void lf_network_reset(struct _lf_network_context *context) {
+	context->unacked = context->next = 0;
+	context->expected = context->consumed = 0;
+	context->duplicates = 0;
+	context->recovering = false;
+	context->srtt = context->rttvar = 0;
+	context->rto = LF_NETWORK_RTO_MS * 1000;
+	for (int i = 0; i < LF_NETWORK_MAX_WINDOW; i ++) {
+		context->sent[i].transmissions = 0;
+		context->received[i].valid = false;
+	}
+}
+
+void lf_network_initialize(struct _lf_network_context *context) {
+	context->session = ((uint32_t)lf_network_now() ^ ((uint32_t)getpid() << 16)) | 1;
+	context->peer = 0;
+	context->window = LF_NETWORK_WINDOW;
+	lf_network_reset(context);
+}
+
+int lf_network_set_window(struct _lf_endpoint *endpoint, uint8_t window) {
+	struct _lf_network_context *context = (struct _lf_network_context *)endpoint->_ctx;
+	lf_assert(window && window <= LF_NETWORK_MAX_WINDOW, failure, E_OVERFLOW, "The window must be between 1 and %i segments.", LF_NETWORK_MAX_WINDOW);
+	context->window = window;
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+/* Sends a segment, acknowledging everything received from the peer so far. */
+int lf_network_send(struct _lf_network_context *context, uint32_t sequence, uint8_t flags, void *data, uint16_t length) {
+	struct _lf_network_header header;
+	header.session = htonl(context->session);
+	header.sequence = htonl(sequence);
+	header.ack = htonl(context->expected);
+	header.length = htons(length);
+	header.flags = flags;
+	header.reserved = 0;
+	struct iovec iov[2] = { { &header, sizeof(header) }, { data, length } };
+	struct msghdr message = { 0 };
+	message.msg_name = &context->device;
+	message.msg_namelen = sizeof(struct sockaddr_in);
+	message.msg_iov = iov;
+	message.msg_iovlen = 2;
+	ssize_t _e = sendmsg(context->fd, &message, 0);
+	lf_assert(_e > 0, failure, E_COMMUNICATION, "Failed to send data to networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+/* Sends or resends one of the outstanding segments. */
+int lf_network_transmit(struct _lf_network_context *context, uint32_t sequence) {
+	struct _lf_network_segment *segment = &context->sent[sequence % LF_NETWORK_MAX_WINDOW];
+	segment->sent = lf_network_now();
+	segment->transmissions ++;
+	/* The timer always covers the oldest outstanding segment. */
+	if (sequence == context->unacked) context->deadline = segment->sent + context->rto;
+	return lf_network_send(context, sequence, segment->header.flags, segment->data, segment->header.length);
+}
+
+/* Updates the retransmission timeout from a round trip time in microseconds, or undoes any backoff if the time is zero. */
+void lf_network_measure(struct _lf_network_context *context, uint32_t rtt) {
+	if (!context->srtt) {
+		if (!rtt) return;
+		context->srtt = rtt;
+		context->rttvar = rtt / 2;
+	} else if (rtt) {
+		uint32_t delta = (context->srtt > rtt) ? context->srtt - rtt : rtt - context->srtt;
+		context->rttvar = (3 * context->rttvar + delta) / 4;
+		context->srtt = (7 * context->srtt + rtt) / 8;
+	}
+	context->rto = context->srtt + 4 * context->rttvar;
+	if (context->rto < LF_NETWORK_MIN_RTO_MS * 1000) context->rto = LF_NETWORK_MIN_RTO_MS * 1000;
+	if (context->rto > LF_NETWORK_MAX_RTO_MS * 1000) context->rto = LF_NETWORK_MAX_RTO_MS * 1000;
+}
+
+/* Handles an acknowledgement from the peer. */
+void lf_network_acknowledged(struct _lf_network_context *context, uint32_t ack, bool duplicate) {
+	if (lf_network_before(context->unacked, ack) && !lf_network_before(context->next, ack)) {
+		/* Only segments that were sent once, and were not held up behind a loss, give an unambiguous round trip time. */
+		struct _lf_network_segment *last = &context->sent[(ack - 1) % LF_NETWORK_MAX_WINDOW];
+		/* Otherwise the peer is still responding, so there is no reason to keep backing off. */
+		lf_network_measure(context, (last->transmissions == 1 && !context->recovering) ? lf_network_now() - last->sent : 0);
+		for (uint32_t sequence = context->unacked; sequence != ack; sequence ++) {
+			context->sent[sequence % LF_NETWORK_MAX_WINDOW].transmissions = 0;
+		}
+		context->unacked = ack;
+		context->duplicates = 0;
+		if (context->recovering && lf_network_before(ack, context->recover)) {
+			/* Only part of what was outstanding at the loss has arrived, so the next segment was lost as well. */
+			lf_network_transmit(context, ack);
+		} else {
+			context->recovering = false;
+			if (ack != context->next) context->deadline = lf_network_now() + context->rto;
+		}
+	} else if (duplicate && ack == context->unacked && ack != context->next) {
+		/* Segments after the oldest are arriving without it, so it has most likely been lost. */
+		if (++ context->duplicates == LF_NETWORK_DUPLICATES && !context->recovering) {
+			context->recovering = true;
+			context->recover = context->next;
+			lf_network_transmit(context, ack);
+		}
+	}
+}
+
+/* Waits up to the given number of milliseconds for a datagram and handles it. Returns the number of datagrams handled. */
+int lf_network_receive(struct _lf_network_context *context, int timeout) {
+	struct pollfd fd = { context->fd, POLLIN, 0 };
+	int _e = poll(&fd, 1, timeout);
+	lf_assert(_e >= 0, failure, E_COMMUNICATION, "Failed to wait for data from networked device '%s'.", context->host);
+	if (_e == 0) return 0;
+	struct {
+		struct _lf_network_header header;
+		uint8_t data[LF_NETWORK_SEGMENT_SIZE];
+	} datagram;
+	struct sockaddr_in from;
+	socklen_t _length = sizeof(from);
+	ssize_t size = recvfrom(context->fd, &datagram, sizeof(datagram), 0, (struct sockaddr *)&from, &_length);
+	lf_assert(size > 0, failure, E_COMMUNICATION, "Failed to receive data from networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
+	uint32_t session = ntohl(datagram.header.session);
+	uint32_t sequence = ntohl(datagram.header.sequence);
+	uint16_t length = ntohs(datagram.header.length);
+	uint8_t flags = datagram.header.flags;
+	/* Drop anything that is not a whole segment. */
+	if ((size_t)size < sizeof(struct _lf_network_header) || length != size - sizeof(struct _lf_network_header)) return 1;
+	if (session != context->peer) {
+		/* A peer that has restarted knows nothing of what was exchanged with it before. */
+		if (context->peer) lf_network_reset(context);
+		context->peer = session;
+		context->device = from;
+	}
+	lf_network_acknowledged(context, ntohl(datagram.header.ack), !(flags & LF_NETWORK_DATA));
+	if (flags & LF_NETWORK_DATA) {
+		/* Buffer the segment if it is new and there is space for it, even if earlier segments are missing. */
+		if (!lf_network_before(sequence, context->expected) && lf_network_before(sequence, context->consumed + LF_NETWORK_MAX_WINDOW)) {
+			struct _lf_network_segment *segment = &context->received[sequence % LF_NETWORK_MAX_WINDOW];
+			if (!segment->valid) {
+				segment->header.sequence = sequence;
+				segment->header.length = length;
+				segment->header.flags = flags;
+				memcpy(segment->data, datagram.data, length);
+				segment->valid = true;
+			}
+			while (lf_network_before(context->expected, context->consumed + LF_NETWORK_MAX_WINDOW)) {
+				segment = &context->received[context->expected % LF_NETWORK_MAX_WINDOW];
+				if (!segment->valid || segment->header.sequence != context->expected) break;
+				context->expected ++;
+			}
+		}
+		/* Acknowledge every data segment, so that the peer learns of gaps from duplicate acknowledgements. */
+		lf_network_send(context, context->next, 0, NULL, 0);
+	}
+	return 1;
+failure:
+	return lf_error;
+}
+
+/* Waits for the peer until the given time, retransmitting whenever the oldest outstanding segment times out. */
+int lf_network_wait(struct _lf_network_context *context, uint64_t until) {
+	uint64_t now = lf_network_now();
+	if (context->unacked != context->next && context->deadline <= now) {
+		struct _lf_network_segment *segment = &context->sent[context->unacked % LF_NETWORK_MAX_WINDOW];
+		if (segment->transmissions > LF_NETWORK_RETRIES) {
+			/* Give up on the peer, discarding everything that it has not acknowledged. */
+			context->unacked = context->next;
+			context->recovering = false;
+			lf_error_raise(E_TIMEOUT, error_message("The networked device '%s' stopped responding.", context->host));
+			return lf_error;
+		}
+		/* Back off, in case the timeout was caused by congestion rather than loss. */
+		context->rto = (context->rto * 2 > LF_NETWORK_MAX_RTO_MS * 1000) ? LF_NETWORK_MAX_RTO_MS * 1000 : context->rto * 2;
+		context->recovering = true;
+		context->recover = context->next;
+		lf_network_transmit(context, context->unacked);
+	}
+	if (context->unacked != context->next && context->deadline < until) until = context->deadline;
+	int timeout = -1;
+	if (until != UINT64_MAX) timeout = (until > now) ? (int)((until - now + 999) / 1000) : 0;
+	return lf_network_receive(context, timeout);
+}
+
 int lf_network_configure(struct _lf_endpoint *endpoint, void *_ctx) {
 return lf_success;
 }
 
+/* Handles every datagram that has arrived without waiting, then returns whether a whole message is ready to be pulled. */
 bool lf_network_ready(struct _lf_endpoint *endpoint) {
+	struct _lf_network_context *context = (struct _lf_network_context *)endpoint->_ctx;
+	while (lf_network_receive(context, 0) > 0);
+	lf_error_clear();
+	for (uint32_t sequence = context->consumed; sequence != context->expected; sequence ++) {
+		if (context->received[sequence % LF_NETWORK_MAX_WINDOW].header.flags & LF_NETWORK_END) return true;
+	}
 	return false;
 }
 
+int lf_network_descriptors(struct _lf_endpoint *endpoint, int *fds, int count) {
+	struct _lf_network_context *context = (struct _lf_network_context *)endpoint->_ctx;
+	if (count < 1) return 0;
+	fds[0] = context->fd;
+	return 1;
+}
+
 int lf_network_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
 	/* Obtain a pointer to and cast to the network context associated with the active endpoint. */
 	struct _lf_network_context *context = (struct _lf_network_context *)endpoint->_ctx;
-	ssize_t _e = sendto(context->fd, source, length, 0, (struct sockaddr *)&context->device, sizeof(struct sockaddr_in));
-	lf_assert(_e > 0, failure, E_COMMUNICATION, "Failed to send data to networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
+	uint8_t *data = source;
+	/* The message is split into segments, and ends with the segment that carries its last byte. */
+	do {
+		while (context->next - context->unacked >= context->window) {
+			int _e = lf_network_wait(context, UINT64_MAX);
+			lf_assert(_e != lf_error, failure, E_COMMUNICATION, "Failed to send data to networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
+		}
+		struct _lf_network_segment *segment = &context->sent[context->next % LF_NETWORK_MAX_WINDOW];
+		segment->header.length = (length > LF_NETWORK_SEGMENT_SIZE) ? LF_NETWORK_SEGMENT_SIZE : length;
+		segment->header.flags = LF_NETWORK_DATA;
+		if (segment->header.length == length) segment->header.flags |= LF_NETWORK_END;
+		memcpy(segment->data, data, segment->header.length);
+		segment->transmissions = 0;
+		data += segment->header.length;
+		length -= segment->header.length;
+		int _e = lf_network_transmit(context, context->next ++);
+		lf_assert(_e == lf_success, failure, E_COMMUNICATION, "Failed to send data to networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
+	} while (length);
+	/* The message is retransmitted as needed while waiting for the next one, so there is no need to wait for it to be acknowledged. */
 	return lf_success;
 failure:
 	return lf_error;
@@ -23,10 +251,30 @@ failure:
 int lf_network_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
 	/* Obtain a pointer to and cast to the network context associated with the active endpoint. */
 	struct _lf_network_context *context = (struct _lf_network_context *)endpoint->_ctx;
-	socklen_t _length = sizeof(context->device);
-	ssize_t _e = recvfrom(context->fd, destination, length, 0, (struct sockaddr *)&context->device, &_length);
-	lf_assert(_e > 0, failure, E_COMMUNICATION, "Failed to receive data from networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
-	return lf_success;
+	uint8_t *data = destination;
+	uint64_t until = (context->timeout) ? lf_network_now() + context->timeout * 1000 : UINT64_MAX;
+	while (1) {
+		/* Deliver segments in order until the end of the message. Anything that does not fit is discarded. */
+		while (context->consumed != context->expected) {
+			struct _lf_network_segment *segment = &context->received[context->consumed % LF_NETWORK_MAX_WINDOW];
+			lf_size_t size = (segment->header.length < length) ? segment->header.length : length;
+			memcpy(data, segment->data, size);
+			data += size;
+			length -= size;
+			segment->valid = false;
+			context->consumed ++;
+			if (segment->header.flags & LF_NETWORK_END) return lf_success;
+		}
+		int _e = lf_network_wait(context, until);
+		lf_assert(_e != lf_error, failure, E_COMMUNICATION, "Failed to receive data from networked device '%s' at '%s'.", context->host, inet_ntoa(context->device.sin_addr));
+		/* Only give up once the peer has been silent for the whole timeout. */
+		if (_e) {
+			if (context->timeout) until = lf_network_now() + context->timeout * 1000;
+		} else if (lf_network_now() >= until) {
+			lf_error_raise(E_TIMEOUT, error_message("Timed out waiting for data from networked device '%s'.", context->host));
+			return lf_error;
+		}
+	}
 failure:
 	return lf_error;
 }
@@ -34,6 +282,10 @@ failure:
 int lf_network_destroy(struct _lf_endpoint *endpoint) {
 	if (endpoint && endpoint->_ctx) {
 		struct _lf_network_context *context = endpoint->_ctx;
+		/* Make sure the last messages sent have arrived before the socket goes away. */
+		while (context->unacked != context->next) {
+			if (lf_network_wait(context, UINT64_MAX) == lf_error) break;
+		}
 		close(context->fd);
 	}
 	return lf_success;
@@ -59,6 +311,9 @@ struct _lf_endpoint *lf_network_endpoint_for_hostname(char *hostname) {
 	context->device.sin_family = AF_INET;
 	context->device.sin_addr.s_addr = list[0]->s_addr;
 	context->device.sin_port = htons(LF_UDP_PORT);
+	lf_network_initialize(context);
+	context->timeout = LF_NETWORK_TIMEOUT_MS;
+	endpoint->descriptors = lf_network_descriptors;
 	return endpoint;
 failure:
 	if (context) close(context->fd);
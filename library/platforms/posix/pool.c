@@ -0,0 +1,116 @@
+#include <flipper.h>
+#include <flipper/atomic.h>
+
+struct _lf_pool lf_pool;
+
+void *lf_pool_worker(void *_pool) {
+	struct _lf_pool *pool = (struct _lf_pool *)_pool;
+	for (;;) {
+		/* Read the count before looking for a job, so that a job submitted after the look cuts the sleep short. */
+		uint32_t submitted = lf_atomic_load(&pool->submitted);
+		struct _lf_pool_job *job = lf_queue_pop(pool->jobs);
+		if (job) job->func(job);
+		else lf_lock_wait(&pool->submitted, submitted);
+	}
+	return NULL;
+}
+
+int lf_pool_reserve(uint32_t threads) {
+	if (threads > LF_POOL_MAX_THREADS) threads = LF_POOL_MAX_THREADS;
+	if (lf_atomic_load(&lf_pool.threads) >= threads) return lf_success;
+	lf_lock(&lf_pool.lock);
+	if (!lf_pool.jobs) {
+		lf_pool.jobs = lf_queue_create(LF_POOL_JOBS);
+		lf_assert(lf_pool.jobs, release, E_MALLOC, "Failed to allocate the queue of the worker pool.");
+	}
+	while (lf_pool.threads < threads) {
+		pthread_t thread;
+		int _e = pthread_create(&thread, NULL, lf_pool_worker, &lf_pool);
+		lf_assert(_e == 0, release, E_MALLOC, "Failed to start a worker thread.");
+		/* Workers live as long as the process, so nothing waits for them to exit. */
+		pthread_detach(thread);
+		lf_atomic_add(&lf_pool.threads, 1);
+	}
+	lf_unlock(&lf_pool.lock);
+	return lf_success;
+release:
+	lf_unlock(&lf_pool.lock);
+	return lf_error;
+}
+
+int lf_pool_submit(struct _lf_pool_job *job) {
+	lf_assert(lf_atomic_load(&lf_pool.threads), failure, E_NULL, "The pool has no workers. Call 'lf_pool_reserve' first.");
+	lf_assert(lf_queue_push(lf_pool.jobs, job), failure, E_OVERFLOW, "Too many jobs are waiting for a worker.");
+	lf_atomic_add(&lf_pool.submitted, 1);
+	lf_lock_wake(&lf_pool.submitted);
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+void lf_fanout_perform(struct _lf_pool_job *_job) {
+	struct _lf_fanout_job *job = (struct _lf_fanout_job *)_job;
+	struct _lf_fanout *fanout = job->fanout;
+	/* Modules without a device of their own are invoked on the job's device, without disturbing other threads. */
+	struct _lf_device *previous = lf_set_thread_device(job->device);
+	lf_error_clear();
+	if (fanout->push) {
+		job->result->value = lf_push(fanout->module, fanout->function, fanout->source, fanout->length, fanout->args);
+	} else {
+		job->result->value = lf_invoke(fanout->module, fanout->function, fanout->ret, fanout->args);
+	}
+	/* Errors are kept per thread, so they are carried back in the result. */
+	job->result->error = lf_error_get();
+	lf_set_thread_device(previous);
+	if (lf_atomic_add(&fanout->remaining, (uint32_t)-1) == 0) lf_lock_wake(&fanout->remaining);
+}
+
+int lf_fanout(struct _lf_fanout *fanout, struct _lf_device **devices, struct _fmr_result *results, int count) {
+	lf_assert(fanout->module && devices && results, failure, E_NULL, "Invalid parameter provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_assert(!fanout->module->device, failure, E_MODULE, "The module '%s' is bound to a single device, so it cannot be invoked on all of them.", fanout->module->name);
+	struct _lf_fanout_job *jobs = NULL;
+	lf_lock(&lf_attached_lock);
+	int found = lf_vector_count(&lf_attached_devices);
+	lf_assert(found <= count, unlock, E_OVERFLOW, "%i devices are attached, but there is only room for the results of %i.", found, count);
+	memcpy(devices, lf_attached_devices.items, found * sizeof(struct _lf_device *));
+	/* Each device is retained, so that none of them can be released while a worker is using it. */
+	for (int i = 0; i < found; i ++) lf_device_retain(devices[i]);
+	lf_unlock(&lf_attached_lock);
+	if (!found) return 0;
+	jobs = calloc(found, sizeof(struct _lf_fanout_job));
+	lf_assert(jobs, release, E_MALLOC, "Failed to allocate memory for a call to every device.");
+	memset(results, 0, found * sizeof(struct _fmr_result));
+	/* One worker per device lets the call take as long as the slowest device, rather than all of them in turn. */
+	if (lf_pool_reserve(found) != lf_success) lf_error_clear();
+	fanout->remaining = found;
+	for (int i = 0; i < found; i ++) {
+		jobs[i].job.func = lf_fanout_perform;
+		jobs[i].fanout = fanout;
+		jobs[i].device = devices[i];
+		jobs[i].result = &results[i];
+		/* If no worker can take the job, make the call here rather than lose it. */
+		if (lf_pool_submit(&jobs[i].job) != lf_success) lf_fanout_perform(&jobs[i].job);
+	}
+	uint32_t remaining;
+	while ((remaining = lf_atomic_load(&fanout->remaining))) lf_lock_wait(&fanout->remaining, remaining);
+	free(jobs);
+	for (int i = 0; i < found; i ++) lf_device_release(devices[i]);
+	return found;
+release:
+	for (int i = 0; i < found; i ++) lf_device_release(devices[i]);
+	return lf_error;
+unlock:
+	lf_unlock(&lf_attached_lock);
+failure:
+	return lf_error;
+}
+
+int lf_invoke_all(struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *args, struct _lf_device **devices, struct _fmr_result *results, int count) {
+	struct _lf_fanout fanout = { module, function, ret, args, NULL, 0, false, 0 };
+	return lf_fanout(&fanout, devices, results, count);
+}
+
+int lf_push_all(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _fmr_args *args, struct _lf_device **devices, struct _fmr_result *results, int count) {
+	struct _lf_fanout fanout = { module, function, lf_int_t, args, source, length, true, 0 };
+	return lf_fanout(&fanout, devices, results, count);
+}
@@ -0,0 +1,185 @@
+#include <flipper.h>
+#include <flipper/atomic.h>
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+/* The epoll instance that every registered endpoint is waited on through. */
+int lf_reactor_fd = -1;
+/* Fires every LF_REACTOR_POLL_MS while any device needs to be polled. */
+int lf_reactor_timer = -1;
+/* Written to by lf_reactor_wake, so that messages queued from other threads are handled without waiting for their device. */
+int lf_reactor_wakeup = -1;
+/* Set while a wakeup is pending, so that a burst of messages only writes to the wakeup once. */
+uint32_t lf_reactor_woken;
+/* The devices whose endpoints cannot be waited on. Changed and walked under the lock of the attached devices. */
+struct _lf_vector lf_reactor_polled;
+
+/* Creates the epoll instance and the poll timer on first use. */
+int lf_reactor_create(void) {
+	if (lf_reactor_fd >= 0) return lf_success;
+	lf_reactor_fd = epoll_create1(EPOLL_CLOEXEC);
+	lf_assert(lf_reactor_fd >= 0, failure, E_UNIMPLEMENTED, "Failed to create the event reactor.");
+	lf_reactor_timer = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+	lf_assert(lf_reactor_timer >= 0, failure, E_TIMER, "Failed to create the event reactor's poll timer.");
+	/* The timer is told apart from the devices by having no device attached to it. */
+	struct epoll_event event = { EPOLLIN, { .ptr = NULL } };
+	int _e = epoll_ctl(lf_reactor_fd, EPOLL_CTL_ADD, lf_reactor_timer, &event);
+	lf_assert(_e == 0, failure, E_TIMER, "Failed to wait on the event reactor's poll timer.");
+	lf_reactor_wakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	lf_assert(lf_reactor_wakeup >= 0, failure, E_UNIMPLEMENTED, "Failed to create the event reactor's wakeup.");
+	/* The wakeup is told apart by the address of its descriptor. */
+	event.data.ptr = &lf_reactor_wakeup;
+	_e = epoll_ctl(lf_reactor_fd, EPOLL_CTL_ADD, lf_reactor_wakeup, &event);
+	lf_assert(_e == 0, failure, E_UNIMPLEMENTED, "Failed to wait on the event reactor's wakeup.");
+	return lf_success;
+failure:
+	if (lf_reactor_wakeup >= 0) close(lf_reactor_wakeup);
+	if (lf_reactor_timer >= 0) close(lf_reactor_timer);
+	if (lf_reactor_fd >= 0) close(lf_reactor_fd);
+	lf_reactor_fd = lf_reactor_timer = lf_reactor_wakeup = -1;
+	return lf_error;
+}
+
+/* Only keeps the poll timer running while there is something to poll. */
+void lf_reactor_arm(void) {
+	struct itimerspec interval = { { 0, 0 }, { 0, 0 } };
+	if (lf_vector_count(&lf_reactor_polled)) {
+		interval.it_interval.tv_nsec = interval.it_value.tv_nsec = LF_REACTOR_POLL_MS * 1000000;
+	}
+	timerfd_settime(lf_reactor_timer, 0, &interval, NULL);
+}
+
+int lf_reactor_register(struct _lf_device *device) {
+	lf_assert(device && device->endpoint, failure, E_NULL, "Invalid device provided to '%s'.", __PRETTY_FUNCTION__);
+	int _e = lf_reactor_create();
+	lf_assert(_e == lf_success, failure, E_UNIMPLEMENTED, "Failed to start the event reactor.");
+	struct _lf_endpoint *endpoint = device->endpoint;
+	int fds[LF_REACTOR_MAX_DESCRIPTORS];
+	int count = (endpoint->descriptors) ? endpoint->descriptors(endpoint, fds, LF_REACTOR_MAX_DESCRIPTORS) : 0;
+	for (int i = 0; i < count; i ++) {
+		/* A peer that closes its end is reported, so that the descriptor can stop being waited on. */
+		struct epoll_event event = { EPOLLIN | EPOLLRDHUP, { .ptr = device } };
+		_e = epoll_ctl(lf_reactor_fd, EPOLL_CTL_ADD, fds[i], &event);
+		if (_e == 0) continue;
+		/* A descriptor shared with a device that is already registered, such as those of a libusb context, can only wake one of them. */
+		lf_assert(errno == EEXIST, failure, E_ENDPOINT, "Failed to wait on the endpoint of device '%s'.", device->configuration.name);
+		while (i --) epoll_ctl(lf_reactor_fd, EPOLL_CTL_DEL, fds[i], NULL);
+		count = 0;
+		break;
+	}
+	if (count <= 0) {
+		lf_lock(&lf_attached_lock);
+		_e = lf_vector_append(&lf_reactor_polled, device);
+		lf_reactor_arm();
+		lf_unlock(&lf_attached_lock);
+		lf_assert(_e == lf_success, failure, E_MALLOC, "Failed to poll the endpoint of device '%s'.", device->configuration.name);
+	}
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_reactor_unregister(struct _lf_device *device) {
+	lf_assert(device && device->endpoint, failure, E_NULL, "Invalid device provided to '%s'.", __PRETTY_FUNCTION__);
+	if (lf_reactor_fd < 0) return lf_success;
+	/* A device that is being polled rather than waited on only has to be taken out of the polled devices. */
+	lf_lock(&lf_attached_lock);
+	bool polled = lf_vector_contains(&lf_reactor_polled, device);
+	if (polled) {
+		lf_vector_remove(&lf_reactor_polled, device);
+		lf_reactor_arm();
+	}
+	lf_unlock(&lf_attached_lock);
+	if (polled) return lf_success;
+	struct _lf_endpoint *endpoint = device->endpoint;
+	int fds[LF_REACTOR_MAX_DESCRIPTORS];
+	int count = (endpoint->descriptors) ? endpoint->descriptors(endpoint, fds, LF_REACTOR_MAX_DESCRIPTORS) : 0;
+	for (int i = 0; i < count; i ++) {
+		epoll_ctl(lf_reactor_fd, EPOLL_CTL_DEL, fds[i], NULL);
+	}
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_reactor_poll(int timeout) {
+	int _e = lf_reactor_create();
+	lf_assert(_e == lf_success, failure, E_UNIMPLEMENTED, "Failed to start the event reactor.");
+	struct epoll_event events[LF_REACTOR_MAX_EVENTS];
+	int count = epoll_wait(lf_reactor_fd, events, LF_REACTOR_MAX_EVENTS, timeout);
+	if (count < 0) return 0;
+	int handled = 0;
+	for (int i = 0; i < count; i ++) {
+		struct _lf_device *device = events[i].data.ptr;
+		if (device == (void *)&lf_reactor_wakeup) {
+			/* Cleared before the devices are handled, so that a message queued while they are is woken for again. */
+			uint64_t wakeups;
+			if (read(lf_reactor_wakeup, &wakeups, sizeof(wakeups)) < 0) continue;
+			lf_atomic_store(&lf_reactor_woken, 0);
+			lf_lock(&lf_attached_lock);
+			lf_vector_apply_func(&lf_attached_devices, lf_event_handler, NULL);
+			handled += lf_vector_count(&lf_attached_devices);
+			lf_unlock(&lf_attached_lock);
+		} else if (device) {
+			/* The device may have been detached since the wait returned, so it is only handled if it is still attached. */
+			lf_lock(&lf_attached_lock);
+			bool attached = lf_vector_contains(&lf_attached_devices, device);
+			if (attached) lf_device_retain(device);
+			lf_unlock(&lf_attached_lock);
+			if (!attached) continue;
+			lf_event_handler(device, NULL);
+			/* Once the peer has gone away the descriptor is always readable, so it is no longer waited on. */
+			if (events[i].events & (EPOLLHUP | EPOLLRDHUP)) lf_reactor_unregister(device);
+			lf_device_release(device);
+			lf_error_clear();
+			handled ++;
+		} else {
+			/* Acknowledge the timer, then poll every device that cannot be waited on. */
+			uint64_t expirations;
+			if (read(lf_reactor_timer, &expirations, sizeof(expirations)) < 0) continue;
+			lf_lock(&lf_attached_lock);
+			lf_vector_apply_func(&lf_reactor_polled, lf_event_handler, NULL);
+			handled += lf_vector_count(&lf_reactor_polled);
+			lf_unlock(&lf_attached_lock);
+		}
+	}
+	return handled;
+failure:
+	return lf_error;
+}
+
+void lf_reactor_wake(void) {
+	if (lf_reactor_wakeup < 0) return;
+	uint32_t idle = 0;
+	if (!lf_atomic_cas(&lf_reactor_woken, &idle, 1)) return;
+	uint64_t one = 1;
+	if (write(lf_reactor_wakeup, &one, sizeof(one)) < 0) lf_atomic_store(&lf_reactor_woken, 0);
+}
+
+void lf_handle_events(void) {
+	/* Sleep until one of the attached devices has data, rather than checking them continuously. */
+	for (;;) {
+		if (lf_reactor_poll(-1) == lf_error) return;
+	}
+}
+
+#else
+
+int lf_reactor_register(struct _lf_device *device) {
+	return lf_success;
+}
+
+int lf_reactor_unregister(struct _lf_device *device) {
+	return lf_success;
+}
+
+int lf_reactor_poll(int timeout) {
+	return 0;
+}
+
+#endif
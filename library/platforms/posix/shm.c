@@ -0,0 +1,267 @@
+#include <flipper/posix/shm.h>
+#include <flipper/error.h>
+#include <flipper.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+/* Returns a monotonic time in milliseconds. */
+uint64_t lf_shm_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/* Sleeps until the word may no longer hold the value, for at most the given number of milliseconds. */
+void lf_shm_sleep(uint32_t *word, uint32_t value, uint32_t ms) {
+#if defined(__linux__)
+	struct timespec timeout = { ms / 1000, (ms % 1000) * 1000000 };
+	/* The region is shared between processes, so the private futex operations cannot be used. */
+	syscall(SYS_futex, word, FUTEX_WAIT, value, &timeout, NULL, 0);
+#else
+	(void)word;
+	(void)value;
+	(void)ms;
+	usleep(50);
+#endif
+}
+
+/* Wakes whoever is sleeping on the word. */
+void lf_shm_wake(uint32_t *word) {
+#if defined(__linux__)
+	syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+#else
+	(void)word;
+#endif
+}
+
+/* Returns true if another host has attached since this endpoint last looked, in which case everything in flight has been thrown away. */
+bool lf_shm_replaced(struct _lf_shm_context *context) {
+	uint32_t session = __atomic_load_n(&context->region->session, __ATOMIC_ACQUIRE);
+	if (session == context->session) return false;
+	context->session = session;
+	/* The device skips whatever the previous host left behind, and resumes reading where the new host started writing. */
+	if (context->owner) __atomic_store_n(&context->in->tail, context->region->start, __ATOMIC_RELEASE);
+	return true;
+}
+
+/* Waits until the word no longer holds the value. The flag tells the other side to wake this one once it changes the word. */
+int lf_shm_wait(struct _lf_shm_context *context, uint32_t *word, uint32_t value, uint32_t *flag, uint64_t until) {
+	/* The other side usually answers within a few microseconds, which is much less than the cost of sleeping. */
+	for (uint32_t i = 0; i < context->spin; i ++) {
+		if (__atomic_load_n(word, __ATOMIC_ACQUIRE) != value) goto done;
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#endif
+	}
+	__atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(word, __ATOMIC_SEQ_CST) == value) {
+		if (lf_shm_replaced(context)) {
+			__atomic_store_n(flag, 0, __ATOMIC_RELAXED);
+			goto replaced;
+		}
+		uint64_t now = lf_shm_now();
+		if (now >= until) {
+			__atomic_store_n(flag, 0, __ATOMIC_RELAXED);
+			lf_error_raise(E_TIMEOUT, error_message("Timed out waiting for the peer at '%s'.", context->name));
+			return lf_error;
+		}
+		/* Wake up periodically to notice a new host, which does not touch the word being waited on. */
+		lf_shm_sleep(word, value, (until - now < 100) ? until - now : 100);
+	}
+	__atomic_store_n(flag, 0, __ATOMIC_RELAXED);
+done:
+	if (lf_shm_replaced(context)) goto replaced;
+	return lf_success;
+replaced:
+	lf_error_raise(E_COMMUNICATION, error_message("A new host attached to '%s'.", context->name));
+	return lf_error;
+}
+
+/* Copies the buffers into the outgoing ring, only publishing them when it has to wait for space and once it is done. */
+int lf_shm_write(struct _lf_shm_context *context, struct iovec *iov, int count, uint64_t until) {
+	struct _lf_shm_ring *ring = context->out;
+	uint32_t head = ring->head;
+	for (int i = 0; i < count; i ++) {
+		uint8_t *data = iov[i].iov_base;
+		size_t length = iov[i].iov_len;
+		while (length) {
+			uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+			uint32_t space = LF_SHM_RING_SIZE - (head - tail);
+			if (!space) {
+				__atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);
+				if (__atomic_load_n(&ring->empty, __ATOMIC_RELAXED)) lf_shm_wake(&ring->head);
+				int _e = lf_shm_wait(context, &ring->tail, tail, &ring->full, until);
+				if (_e != lf_success) return lf_error;
+				continue;
+			}
+			uint32_t offset = head & (LF_SHM_RING_SIZE - 1);
+			uint32_t size = (length < space) ? length : space;
+			/* Copy up to the end of the ring, then wrap around to its start. */
+			uint32_t first = (size < LF_SHM_RING_SIZE - offset) ? size : LF_SHM_RING_SIZE - offset;
+			memcpy(&ring->data[offset], data, first);
+			memcpy(ring->data, data + first, size - first);
+			head += size;
+			data += size;
+			length -= size;
+		}
+	}
+	/* A reply meant for a host that has been replaced is dropped rather than handed to the new one. */
+	if (lf_shm_replaced(context)) {
+		lf_error_raise(E_COMMUNICATION, error_message("A new host attached to '%s'.", context->name));
+		return lf_error;
+	}
+	__atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&ring->empty, __ATOMIC_RELAXED)) lf_shm_wake(&ring->head);
+	return lf_success;
+}
+
+/* Copies the given number of bytes out of the incoming ring, or discards them if there is no destination. */
+int lf_shm_read(struct _lf_shm_context *context, void *destination, size_t length, uint64_t until) {
+	struct _lf_shm_ring *ring = context->in;
+	uint8_t *data = destination;
+	uint32_t tail = ring->tail;
+	while (length) {
+		uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+		uint32_t available = head - tail;
+		if (!available) {
+			/* Make room for the rest of a message that is larger than the ring. */
+			__atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			if (__atomic_load_n(&ring->full, __ATOMIC_RELAXED)) lf_shm_wake(&ring->tail);
+			int _e = lf_shm_wait(context, &ring->head, head, &ring->empty, until);
+			if (_e != lf_success) return lf_error;
+			continue;
+		}
+		uint32_t offset = tail & (LF_SHM_RING_SIZE - 1);
+		uint32_t size = (length < available) ? length : available;
+		if (data) {
+			uint32_t first = (size < LF_SHM_RING_SIZE - offset) ? size : LF_SHM_RING_SIZE - offset;
+			memcpy(data, &ring->data[offset], first);
+			memcpy(data + first, ring->data, size - first);
+			data += size;
+		}
+		tail += size;
+		length -= size;
+	}
+	__atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&ring->full, __ATOMIC_RELAXED)) lf_shm_wake(&ring->tail);
+	return lf_success;
+}
+
+int lf_shm_configure(struct _lf_endpoint *endpoint, void *_ctx) {
+	return lf_success;
+}
+
+bool lf_shm_ready(struct _lf_endpoint *endpoint) {
+	return false;
+}
+
+int lf_shm_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_shm_context *context = (struct _lf_shm_context *)endpoint->_ctx;
+	uint64_t until = (context->timeout) ? lf_shm_now() + context->timeout : UINT64_MAX;
+	uint32_t prefix = length;
+	struct iovec iov[2] = { { &prefix, sizeof(prefix) }, { source, length } };
+	int _e = lf_shm_write(context, iov, 2, until);
+	lf_assert(_e == lf_success, failure, E_COMMUNICATION, "Failed to send data to device at '%s'.", context->name);
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_shm_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_shm_context *context = (struct _lf_shm_context *)endpoint->_ctx;
+	uint64_t until = (context->timeout) ? lf_shm_now() + context->timeout : UINT64_MAX;
+	/* Catch up with a new host between messages, where nothing is lost by doing so. */
+	if (context->owner) lf_shm_replaced(context);
+	uint32_t prefix;
+	int _e = lf_shm_read(context, &prefix, sizeof(prefix), until);
+	if (_e != lf_success) return lf_error;
+	/* Like a datagram, a message that is larger than the buffer is truncated. */
+	_e = lf_shm_read(context, destination, (prefix < length) ? prefix : length, until);
+	if (_e != lf_success) return lf_error;
+	if (prefix > length) return lf_shm_read(context, NULL, prefix - length, until);
+	return lf_success;
+}
+
+int lf_shm_destroy(struct _lf_endpoint *endpoint) {
+	if (endpoint && endpoint->_ctx) {
+		struct _lf_shm_context *context = endpoint->_ctx;
+		if (context->region) munmap(context->region, sizeof(struct _lf_shm_region));
+		if (context->owner) shm_unlink(context->name);
+	}
+	return lf_success;
+}
+
+/* Maps the named region and creates an endpoint for it. */
+struct _lf_endpoint *lf_shm_endpoint_open(char *name, bool create) {
+	struct _lf_shm_context *context = NULL;
+	struct _lf_endpoint *endpoint = lf_endpoint_create(lf_shm_configure,
+													   lf_shm_ready,
+													   lf_shm_push,
+													   lf_shm_pull,
+													   lf_shm_destroy,
+													   sizeof(struct _lf_shm_context));
+	lf_assert(endpoint, failure, E_ENDPOINT, "Failed to create endpoint for shared memory.");
+	context = (struct _lf_shm_context *)endpoint->_ctx;
+	lf_assert(strlen(name) < sizeof(context->name), release, E_OVERFLOW, "The shared memory name '%s' is too long.", name);
+	strcpy(context->name, name);
+	int fd = shm_open(name, (create) ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR, 0600);
+	lf_assert(fd >= 0, release, E_NO_DEVICE, "Failed to open shared memory '%s'.", name);
+	context->owner = create;
+	/* Spinning only helps if the peer can run at the same time. On a single processor it only delays the peer. */
+	context->spin = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? LF_SHM_SPIN : 0;
+	int _e = (create) ? ftruncate(fd, sizeof(struct _lf_shm_region)) : 0;
+	if (_e == 0) context->region = mmap(NULL, sizeof(struct _lf_shm_region), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	/* The mapping keeps the region alive, so the descriptor is no longer needed. */
+	close(fd);
+	lf_assert(_e == 0 && context->region != MAP_FAILED, release, E_MALLOC, "Failed to map shared memory '%s'.", name);
+	return endpoint;
+release:
+	if (context->region == MAP_FAILED) context->region = NULL;
+	lf_endpoint_release(endpoint);
+failure:
+	return NULL;
+}
+
+struct _lf_endpoint *lf_shm_endpoint_create(char *name) {
+	struct _lf_endpoint *endpoint = lf_shm_endpoint_open(name, true);
+	if (!endpoint) return NULL;
+	struct _lf_shm_context *context = (struct _lf_shm_context *)endpoint->_ctx;
+	context->in = &context->region->rings[0];
+	context->out = &context->region->rings[1];
+	__atomic_store_n(&context->region->magic, LF_SHM_MAGIC, __ATOMIC_RELEASE);
+	return endpoint;
+}
+
+struct _lf_endpoint *lf_shm_endpoint_for_name(char *name) {
+	struct _lf_endpoint *endpoint = lf_shm_endpoint_open(name, false);
+	if (!endpoint) return NULL;
+	struct _lf_shm_context *context = (struct _lf_shm_context *)endpoint->_ctx;
+	struct _lf_shm_region *region = context->region;
+	lf_assert(__atomic_load_n(&region->magic, __ATOMIC_ACQUIRE) == LF_SHM_MAGIC, failure, E_NO_DEVICE, "No device is serving shared memory '%s'.", name);
+	context->out = &region->rings[0];
+	context->in = &region->rings[1];
+	context->timeout = LF_SHM_TIMEOUT_MS;
+	/* Throw away any replies left behind by a previous host, and tell the device where this host's messages start. */
+	__atomic_store_n(&context->in->tail, __atomic_load_n(&context->in->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+	region->start = context->out->head;
+	context->session = __atomic_add_fetch(&region->session, 1, __ATOMIC_SEQ_CST);
+	lf_shm_wake(&context->out->head);
+	lf_shm_wake(&context->in->tail);
+	return endpoint;
+failure:
+	lf_endpoint_release(endpoint);
+	return NULL;
+}
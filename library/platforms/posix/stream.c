@@ -0,0 +1,167 @@
+#include <flipper/posix/stream.h>
+#include <flipper/error.h>
+#include <flipper.h>
+
+#include <errno.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+int lf_stream_configure(struct _lf_endpoint *endpoint, void *_ctx) {
+	return lf_success;
+}
+
+/* Returns whether any part of a message has arrived. A peer that has closed the stream is not ready, as there is nothing to pull. */
+bool lf_stream_ready(struct _lf_endpoint *endpoint) {
+	struct _lf_stream_context *context = (struct _lf_stream_context *)endpoint->_ctx;
+	uint8_t byte;
+	return recv(context->fd, &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT) > 0;
+}
+
+int lf_stream_descriptors(struct _lf_endpoint *endpoint, int *fds, int count) {
+	struct _lf_stream_context *context = (struct _lf_stream_context *)endpoint->_ctx;
+	if (count < 1) return 0;
+	fds[0] = context->fd;
+	return 1;
+}
+
+int lf_stream_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_stream_context *context = (struct _lf_stream_context *)endpoint->_ctx;
+	lf_stream_length_t prefix = htonl(length);
+	/* Send the length and the message together, so that they leave in the same segment. */
+	struct iovec iov[2] = { { &prefix, sizeof(prefix) }, { source, length } };
+	struct msghdr message = { 0 };
+	message.msg_iov = iov;
+	message.msg_iovlen = 2;
+	while (message.msg_iovlen) {
+		/* A peer that has gone away should fail the push rather than raise SIGPIPE. */
+		ssize_t sent = sendmsg(context->fd, &message, MSG_NOSIGNAL);
+		if (sent < 0 && errno == EINTR) continue;
+		lf_assert(sent > 0, failure, E_COMMUNICATION, "Failed to send data to device '%s'.", context->host);
+		/* Skip over whatever was sent if the socket only took part of the message. */
+		while (message.msg_iovlen && (size_t)sent >= message.msg_iov->iov_len) {
+			sent -= message.msg_iov->iov_len;
+			message.msg_iov ++;
+			message.msg_iovlen --;
+		}
+		if (message.msg_iovlen) {
+			message.msg_iov->iov_base = (uint8_t *)message.msg_iov->iov_base + sent;
+			message.msg_iov->iov_len -= sent;
+		}
+	}
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+/* Reads exactly the given number of bytes from the stream. */
+int lf_stream_read(struct _lf_stream_context *context, void *destination, size_t length) {
+	uint8_t *data = destination;
+	while (length) {
+		ssize_t received = recv(context->fd, data, length, 0);
+		if (received < 0 && errno == EINTR) continue;
+		lf_assert(!(received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)), failure, E_TIMEOUT, "Timed out waiting for data from device '%s'.", context->host);
+		lf_assert(received > 0, failure, E_COMMUNICATION, "Failed to receive data from device '%s'.", context->host);
+		data += received;
+		length -= received;
+	}
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_stream_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_stream_context *context = (struct _lf_stream_context *)endpoint->_ctx;
+	lf_stream_length_t prefix;
+	int _e = lf_stream_read(context, &prefix, sizeof(prefix));
+	if (_e != lf_success) return lf_error;
+	lf_size_t size = ntohl(prefix);
+	/* Like a datagram, a message that is larger than the buffer is truncated. */
+	_e = lf_stream_read(context, destination, (size < length) ? size : length);
+	if (_e != lf_success) return lf_error;
+	while (size > length) {
+		uint8_t discard[256];
+		lf_size_t chunk = (size - length < sizeof(discard)) ? size - length : sizeof(discard);
+		_e = lf_stream_read(context, discard, chunk);
+		if (_e != lf_success) return lf_error;
+		size -= chunk;
+	}
+	return lf_success;
+}
+
+int lf_stream_destroy(struct _lf_endpoint *endpoint) {
+	if (endpoint && endpoint->_ctx) {
+		struct _lf_stream_context *context = endpoint->_ctx;
+		close(context->fd);
+	}
+	return lf_success;
+}
+
+struct _lf_endpoint *lf_stream_endpoint_for_socket(int fd, char *host) {
+	struct _lf_endpoint *endpoint = lf_endpoint_create(lf_stream_configure,
+													   lf_stream_ready,
+													   lf_stream_push,
+													   lf_stream_pull,
+													   lf_stream_destroy,
+													   sizeof(struct _lf_stream_context));
+	lf_assert(endpoint, failure, E_ENDPOINT, "Failed to create endpoint for stream socket.");
+	struct _lf_stream_context *context = (struct _lf_stream_context *)endpoint->_ctx;
+	context->fd = fd;
+	strncpy(context->host, host, sizeof(context->host) - 1);
+	endpoint->descriptors = lf_stream_descriptors;
+	return endpoint;
+failure:
+	return NULL;
+}
+
+/* Bounds how long a host waits for a device, so that a device that has gone away fails the pull instead of hanging it. */
+void lf_stream_set_timeout(int fd) {
+	struct timeval timeout = { LF_STREAM_TIMEOUT_MS / 1000, (LF_STREAM_TIMEOUT_MS % 1000) * 1000 };
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
+
+struct _lf_endpoint *lf_tcp_endpoint_for_hostname(char *hostname) {
+	struct hostent *host = gethostbyname(hostname);
+	lf_assert(host, failure, E_COMMUNICATION, "Failed to find device with hostname '%s' on the network.", hostname);
+	struct sockaddr_in device;
+	memset(&device, 0, sizeof(struct sockaddr_in));
+	device.sin_family = AF_INET;
+	device.sin_addr.s_addr = ((struct in_addr **)host->h_addr_list)[0]->s_addr;
+	device.sin_port = htons(LF_TCP_PORT);
+	int fd = socket(AF_INET, SOCK_STREAM, 0);
+	lf_assert(fd >= 0, failure, E_SOCKET, "Failed to create socket for network device.");
+	int _e = connect(fd, (struct sockaddr *)&device, sizeof(device));
+	lf_assert(_e == 0, release, E_COMMUNICATION, "Failed to connect to device with hostname '%s'.", hostname);
+	/* Messages are small and each one is waited on, so they should not be held back to be coalesced. */
+	int nodelay = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+	lf_stream_set_timeout(fd);
+	struct _lf_endpoint *endpoint = lf_stream_endpoint_for_socket(fd, host->h_name);
+	lf_assert(endpoint, release, E_ENDPOINT, "Failed to create endpoint for networked device.");
+	return endpoint;
+release:
+	close(fd);
+failure:
+	return NULL;
+}
+
+struct _lf_endpoint *lf_unix_endpoint_for_path(char *path) {
+	struct sockaddr_un device;
+	memset(&device, 0, sizeof(struct sockaddr_un));
+	device.sun_family = AF_UNIX;
+	lf_assert(strlen(path) < sizeof(device.sun_path), failure, E_OVERFLOW, "The socket path '%s' is too long.", path);
+	strcpy(device.sun_path, path);
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	lf_assert(fd >= 0, failure, E_SOCKET, "Failed to create socket for local device.");
+	int _e = connect(fd, (struct sockaddr *)&device, sizeof(device));
+	lf_assert(_e == 0, release, E_COMMUNICATION, "Failed to connect to device at '%s'.", path);
+	lf_stream_set_timeout(fd);
+	struct _lf_endpoint *endpoint = lf_stream_endpoint_for_socket(fd, path);
+	lf_assert(endpoint, release, E_ENDPOINT, "Failed to create endpoint for local device.");
+	return endpoint;
+release:
+	close(fd);
+failure:
+	return NULL;
+}
@@ -0,0 +1,199 @@
+#include <flipper/posix/trace.h>
+#include <flipper/error.h>
+#include <flipper.h>
+
+#include <time.h>
+
+/* Returns the time in microseconds. */
+uint64_t lf_trace_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+int lf_record_configure(struct _lf_endpoint *endpoint, void *_ctx) {
+	struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+	if (!context->endpoint->configure) return lf_success;
+	return context->endpoint->configure(context->endpoint, _ctx);
+}
+
+bool lf_record_ready(struct _lf_endpoint *endpoint) {
+	struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+	if (!context->endpoint->ready) return false;
+	return context->endpoint->ready(context->endpoint);
+}
+
+int lf_record_descriptors(struct _lf_endpoint *endpoint, int *fds, int count) {
+	struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+	return context->endpoint->descriptors(context->endpoint, fds, count);
+}
+
+/* Returns the error a failed transfer is recorded with. An endpoint may fail without raising one, but the replay must still fail. */
+uint8_t lf_record_error(void) {
+	return (lf_error_get() != E_OK) ? lf_error_get() : E_ENDPOINT;
+}
+
+/* Appends a record of a transfer to the trace. */
+void lf_record_write(struct _lf_record_context *context, uint8_t kind, uint8_t error, void *data, lf_size_t length) {
+	uint64_t now = lf_trace_now();
+	uint64_t delta = now - context->last;
+	context->last = now;
+	struct _lf_trace_record record = { (delta > UINT32_MAX) ? UINT32_MAX : (uint32_t)delta, kind, error, length };
+	fwrite(&record, sizeof(record), 1, context->file);
+	if (length) fwrite(data, length, 1, context->file);
+}
+
+int lf_record_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+	int _e = context->endpoint->push(context->endpoint, source, length);
+	lf_record_write(context, lf_trace_push, (_e == lf_success) ? E_OK : lf_record_error(), source, length);
+	return _e;
+}
+
+int lf_record_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+	int _e = context->endpoint->pull(context->endpoint, destination, length);
+	if (_e == lf_success) {
+		lf_record_write(context, lf_trace_pull, E_OK, destination, length);
+	} else {
+		lf_record_write(context, lf_trace_pull, lf_record_error(), NULL, 0);
+	}
+	return _e;
+}
+
+int lf_record_destroy(struct _lf_endpoint *endpoint) {
+	if (endpoint && endpoint->_ctx) {
+		struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+		fclose(context->file);
+		lf_endpoint_release(context->endpoint);
+	}
+	return lf_success;
+}
+
+struct _lf_endpoint *lf_record_endpoint_for_endpoint(struct _lf_endpoint *wrapped, const char *path) {
+	lf_assert(wrapped && path, failure, E_NULL, "Invalid parameter provided to '%s'.", __PRETTY_FUNCTION__);
+	struct _lf_endpoint *endpoint = lf_endpoint_create(lf_record_configure,
+													   lf_record_ready,
+													   lf_record_push,
+													   lf_record_pull,
+													   NULL,
+													   sizeof(struct _lf_record_context));
+	lf_assert(endpoint, failure, E_ENDPOINT, "Failed to create endpoint for recording.");
+	struct _lf_record_context *context = (struct _lf_record_context *)endpoint->_ctx;
+	context->file = fopen(path, "wb");
+	lf_assert(context->file, release, E_ENDPOINT, "Failed to open '%s' to record to.", path);
+	struct _lf_trace_header header = { LF_TRACE_MAGIC, LF_TRACE_VERSION, 0 };
+	fwrite(&header, sizeof(header), 1, context->file);
+	context->last = lf_trace_now();
+	/* The recorder owns the wrapped endpoint only once it has been set up. */
+	context->endpoint = wrapped;
+	endpoint->destroy = lf_record_destroy;
+	if (wrapped->descriptors) endpoint->descriptors = lf_record_descriptors;
+	return endpoint;
+release:
+	lf_endpoint_release(endpoint);
+failure:
+	return NULL;
+}
+
+/* The number of recorders that have been created from the environment, used to give each its own file. */
+int lf_record_count;
+
+struct _lf_endpoint *lf_record_endpoint_from_env(struct _lf_endpoint *endpoint) {
+	const char *path = getenv(LF_RECORD_ENV);
+	if (!path || !*path) return endpoint;
+	char name[256];
+	if (lf_record_count) snprintf(name, sizeof(name), "%s.%i", path, lf_record_count);
+	else snprintf(name, sizeof(name), "%s", path);
+	struct _lf_endpoint *record = lf_record_endpoint_for_endpoint(endpoint, name);
+	if (!record) return endpoint;
+	lf_record_count ++;
+	return record;
+}
+
+int lf_replay_configure(struct _lf_endpoint *endpoint, void *_ctx) {
+	return lf_success;
+}
+
+bool lf_replay_ready(struct _lf_endpoint *endpoint) {
+	return false;
+}
+
+/* Returns the next record of the given kind, skipping any of the other kind that come before it. */
+struct _lf_trace_record *lf_replay_next(struct _lf_replay_context *context, uint8_t kind) {
+	while (context->cursor + sizeof(struct _lf_trace_record) <= context->size) {
+		struct _lf_trace_record *record = (struct _lf_trace_record *)(context->trace + context->cursor);
+		if (context->cursor + sizeof(struct _lf_trace_record) + record->length > context->size) break;
+		context->cursor += sizeof(struct _lf_trace_record) + record->length;
+		if (record->kind == kind) return record;
+		context->skipped ++;
+	}
+	return NULL;
+}
+
+int lf_replay_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_replay_context *context = (struct _lf_replay_context *)endpoint->_ctx;
+	struct _lf_trace_record *record = lf_replay_next(context, lf_trace_push);
+	lf_assert(record, failure, E_ENDPOINT, "The trace '%s' has no more pushes to replay.", context->path);
+	/* The host is not held to the trace, but pushes that differ from it are counted. */
+	if (record->length != length || memcmp(record + 1, source, length)) context->differed ++;
+	lf_assert(record->error == E_OK, failure, record->error, "Replaying a push that failed while recording '%s'.", context->path);
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_replay_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_replay_context *context = (struct _lf_replay_context *)endpoint->_ctx;
+	struct _lf_trace_record *record = lf_replay_next(context, lf_trace_pull);
+	lf_assert(record, failure, E_ENDPOINT, "The trace '%s' has no more pulls to replay.", context->path);
+	lf_assert(record->error == E_OK, failure, record->error, "Replaying a pull that failed while recording '%s'.", context->path);
+	memcpy(destination, record + 1, (record->length < length) ? record->length : length);
+	if (record->length < length) memset((uint8_t *)destination + record->length, 0, length - record->length);
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_replay_destroy(struct _lf_endpoint *endpoint) {
+	if (endpoint && endpoint->_ctx) {
+		struct _lf_replay_context *context = (struct _lf_replay_context *)endpoint->_ctx;
+		/* Report if the host did not do what it did while the trace was recorded. */
+		if (context->differed || context->skipped) {
+			fprintf(stderr, "Replay of '%s': %llu pushes differed from the trace, %llu records skipped.\n", context->path, (unsigned long long)context->differed, (unsigned long long)context->skipped);
+		}
+		free(context->trace);
+	}
+	return lf_success;
+}
+
+struct _lf_endpoint *lf_replay_endpoint_for_path(const char *path) {
+	lf_assert(path, failure, E_NULL, "Invalid parameter provided to '%s'.", __PRETTY_FUNCTION__);
+	struct _lf_endpoint *endpoint = lf_endpoint_create(lf_replay_configure,
+													   lf_replay_ready,
+													   lf_replay_push,
+													   lf_replay_pull,
+													   lf_replay_destroy,
+													   sizeof(struct _lf_replay_context));
+	lf_assert(endpoint, failure, E_ENDPOINT, "Failed to create endpoint for replay.");
+	struct _lf_replay_context *context = (struct _lf_replay_context *)endpoint->_ctx;
+	strncpy(context->path, path, sizeof(context->path) - 1);
+	/* Load the whole trace up front, so that replaying it does no I/O. */
+	FILE *file = fopen(path, "rb");
+	lf_assert(file, release, E_ENDPOINT, "Failed to open the trace '%s'.", path);
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	if (size > 0) context->trace = malloc(size);
+	if (context->trace && fread(context->trace, size, 1, file) == 1) context->size = size;
+	fclose(file);
+	lf_assert(context->size >= sizeof(struct _lf_trace_header), release, E_ENDPOINT, "Failed to read the trace '%s'.", path);
+	struct _lf_trace_header *header = (struct _lf_trace_header *)context->trace;
+	lf_assert(header->magic == LF_TRACE_MAGIC && header->version == LF_TRACE_VERSION, release, E_TYPE, "'%s' is not a trace that can be replayed.", path);
+	context->cursor = sizeof(struct _lf_trace_header);
+	return endpoint;
+release:
+	lf_endpoint_release(endpoint);
+failure:
+	return NULL;
+}
@@ -2,12 +2,241 @@
 
 #include <flipper.h>
 #include <libusb.h>
+#include <pthread.h>
+
+/* One of the transfers that a large push or pull keeps in flight. */
+struct _lf_libusb_slot {
+	/* The endpoint context that owns the slot. */
+	struct _lf_libusb_context *context;
+	struct libusb_transfer *transfer;
+	/* The part of the caller's buffer that the transfer is moving. */
+	lf_size_t offset;
+	lf_size_t length;
+	/* Set while the transfer is submitted. */
+	bool busy;
+};
 
 struct _lf_libusb_context {
 	struct libusb_device_handle *handle;
 	struct libusb_context *context;
+	/* The device the handle was opened for, so that the endpoint can be found again when the device is unplugged. */
+	struct libusb_device *device;
+	/* Set if the transfer ring was set up, in which case the endpoint holds a reference to the event thread that completes its transfers. */
+	bool async;
+	/* Serializes the transfer state below between the caller and the event thread. */
+	pthread_mutex_t lock;
+	/* Signaled whenever a transfer completes. */
+	pthread_cond_t complete;
+	struct _lf_libusb_slot slots[LF_USB_TRANSFERS];
+	/* The buffer being pushed or pulled, and the endpoint it is moving through. */
+	uint8_t *data;
+	lf_size_t length;
+	uint8_t address;
+	/* The number of bytes of the buffer that have been handed to a transfer. */
+	lf_size_t submitted;
+	/* The number of transfers that have been submitted but have not completed. */
+	uint8_t pending;
+	/* The status of the first transfer that failed. */
+	enum libusb_transfer_status status;
+	/* Holds the part of a buffer that does not fill a whole packet. */
+	uint8_t bounce[BULK_OUT_SIZE];
 };
 
+/* Raises the error that corresponds to a libusb error code or a failed transfer's status. */
+int lf_libusb_error(int status) {
+	if (status == LIBUSB_ERROR_TIMEOUT || status == LIBUSB_TRANSFER_TIMED_OUT) {
+		lf_error_raise(E_TIMEOUT, error_message("The transfer to the device timed out."));
+	} else {
+		lf_error_raise(E_COMMUNICATION, error_message("Error during libusb transfer."));
+	}
+	return lf_error;
+}
+
+/* Moves a buffer through a bulk endpoint using blocking transfers. */
+int lf_libusb_bulk(struct _lf_libusb_context *context, uint8_t address, uint8_t *data, lf_size_t length) {
+	lf_size_t size = (address == BULK_OUT_ENDPOINT) ? BULK_OUT_SIZE : BULK_IN_SIZE;
+	lf_size_t tail = length % size;
+	int transferred;
+	int _e;
+	/* Whole packets are moved straight from or into the caller's buffer in a single transfer. */
+	if (length - tail) {
+		_e = libusb_bulk_transfer(context->handle, address, data, length - tail, &transferred, LF_USB_TIMEOUT_MS);
+		if (_e != 0) return lf_libusb_error(_e);
+		if ((lf_size_t)transferred < length - tail) return lf_libusb_error(LIBUSB_ERROR_IO);
+	}
+	if (!tail) return lf_success;
+	/* The device moves whole packets, so the tail is padded out to a full packet. */
+	if (address == BULK_OUT_ENDPOINT) {
+		memcpy(context->bounce, data + length - tail, tail);
+		memset(context->bounce + tail, 0, size - tail);
+	}
+	_e = libusb_bulk_transfer(context->handle, address, context->bounce, size, &transferred, LF_USB_TIMEOUT_MS);
+	if (_e != 0) return lf_libusb_error(_e);
+	if ((lf_size_t)transferred < tail) return lf_libusb_error(LIBUSB_ERROR_IO);
+	if (address == BULK_IN_ENDPOINT) {
+		memcpy(data + length - tail, context->bounce, tail);
+	}
+	return lf_success;
+}
+
+void lf_libusb_transfer_complete(struct libusb_transfer *transfer);
+
+/* Hands the next part of the buffer to the slot's transfer and submits it. Called with the context locked. */
+int lf_libusb_submit(struct _lf_libusb_slot *slot) {
+	struct _lf_libusb_context *context = slot->context;
+	lf_size_t size = (context->address == BULK_OUT_ENDPOINT) ? BULK_OUT_SIZE : BULK_IN_SIZE;
+	lf_size_t remaining = context->length - context->submitted;
+	slot->offset = context->submitted;
+	uint8_t *buffer;
+	int padded;
+	if (remaining >= size) {
+		/* Whole packets are moved straight from or into the caller's buffer. */
+		slot->length = (remaining > LF_USB_TRANSFER_SIZE) ? LF_USB_TRANSFER_SIZE : remaining - remaining % size;
+		buffer = context->data + slot->offset;
+		padded = slot->length;
+	} else {
+		/* The device moves whole packets, so the tail is padded out to a full packet. */
+		slot->length = remaining;
+		buffer = context->bounce;
+		padded = size;
+		if (context->address == BULK_OUT_ENDPOINT) {
+			memcpy(buffer, context->data + slot->offset, slot->length);
+			memset(buffer + slot->length, 0, padded - slot->length);
+		}
+	}
+	libusb_fill_bulk_transfer(slot->transfer, context->handle, context->address, buffer, padded, lf_libusb_transfer_complete, slot, LF_USB_TIMEOUT_MS);
+	int _e = libusb_submit_transfer(slot->transfer);
+	if (_e != 0) return lf_error;
+	context->submitted += slot->length;
+	context->pending ++;
+	slot->busy = true;
+	return lf_success;
+}
+
+/* Called on the event thread when a transfer completes. Refills the transfer with the next part of the buffer. */
+void lf_libusb_transfer_complete(struct libusb_transfer *transfer) {
+	struct _lf_libusb_slot *slot = transfer->user_data;
+	struct _lf_libusb_context *context = slot->context;
+	pthread_mutex_lock(&context->lock);
+	slot->busy = false;
+	context->pending --;
+	enum libusb_transfer_status status = transfer->status;
+	if (status == LIBUSB_TRANSFER_COMPLETED && context->address == BULK_IN_ENDPOINT) {
+		/* A short packet means the device sent less than was asked for. */
+		if ((lf_size_t)transfer->actual_length < slot->length) status = LIBUSB_TRANSFER_ERROR;
+		else if (transfer->buffer == context->bounce) memcpy(context->data + slot->offset, context->bounce, slot->length);
+	}
+	if (status != LIBUSB_TRANSFER_COMPLETED) {
+		/* Record the first failure and stop the transfers still waiting for data. */
+		if (context->status == LIBUSB_TRANSFER_COMPLETED) context->status = status;
+		for (int i = 0; i < LF_USB_TRANSFERS; i ++) {
+			if (context->slots[i].busy) libusb_cancel_transfer(context->slots[i].transfer);
+		}
+	} else if (context->status == LIBUSB_TRANSFER_COMPLETED && context->submitted < context->length) {
+		if (lf_libusb_submit(slot) != lf_success) context->status = LIBUSB_TRANSFER_ERROR;
+	}
+	pthread_cond_signal(&context->complete);
+	pthread_mutex_unlock(&context->lock);
+}
+
+/* Handles the events of the libusb context for every endpoint and the hotplug thread, so that there is one thread however many devices are open. */
+struct _lf_libusb_events {
+	struct libusb_context *context;
+	pthread_t thread;
+	/* The number of endpoints and hotplug sessions that need events handled. The thread runs while this is not 0. */
+	uint32_t references;
+	/* Set to stop the thread. */
+	volatile int stop;
+} lf_libusb_events;
+/* Serializes starting and stopping the event thread. */
+pthread_mutex_t lf_libusb_events_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Handles libusb events until the last reference to the thread is released. Sleeps until there is an event, rather than waking up to check whether to stop. */
+void *lf_libusb_event_thread(void *_events) {
+	struct _lf_libusb_events *events = _events;
+	while (!events->stop) libusb_handle_events_completed(events->context, (int *)&events->stop);
+	return NULL;
+}
+
+/* Starts the event thread, unless it is already running. */
+int lf_libusb_events_retain(struct libusb_context *usb) {
+	struct _lf_libusb_events *events = &lf_libusb_events;
+	pthread_mutex_lock(&lf_libusb_events_lock);
+	lf_assert(!events->references || events->context == usb, release, E_LIBUSB, "USB events are already being handled for another libusb context.");
+	if (!events->references) {
+		events->context = usb;
+		events->stop = 0;
+		int _e = pthread_create(&events->thread, NULL, lf_libusb_event_thread, events);
+		lf_assert(_e == 0, release, E_ENDPOINT, "Failed to start the USB event thread.");
+	}
+	events->references ++;
+	pthread_mutex_unlock(&lf_libusb_events_lock);
+	return lf_success;
+release:
+	pthread_mutex_unlock(&lf_libusb_events_lock);
+	return lf_error;
+}
+
+/* Stops the event thread once nothing needs it. */
+void lf_libusb_events_release(void) {
+	struct _lf_libusb_events *events = &lf_libusb_events;
+	pthread_mutex_lock(&lf_libusb_events_lock);
+	if (events->references && !-- events->references) {
+		events->stop = 1;
+		/* Wake the thread from waiting for events that may never come. */
+		libusb_interrupt_event_handler(events->context);
+		pthread_join(events->thread, NULL);
+	}
+	pthread_mutex_unlock(&lf_libusb_events_lock);
+}
+
+/* Moves a buffer through a bulk endpoint using a ring of transfers that are kept in flight. */
+int lf_libusb_transfer(struct _lf_libusb_context *context, uint8_t address, void *data, lf_size_t length) {
+	pthread_mutex_lock(&context->lock);
+	context->data = data;
+	context->length = length;
+	context->address = address;
+	context->submitted = 0;
+	context->status = LIBUSB_TRANSFER_COMPLETED;
+	for (int i = 0; i < LF_USB_TRANSFERS && context->submitted < length; i ++) {
+		if (lf_libusb_submit(&context->slots[i]) != lf_success) {
+			context->status = LIBUSB_TRANSFER_ERROR;
+			break;
+		}
+	}
+	/* Completed transfers are refilled by the event thread until the whole buffer has been moved. */
+	while (context->pending) pthread_cond_wait(&context->complete, &context->lock);
+	enum libusb_transfer_status status = context->status;
+	pthread_mutex_unlock(&context->lock);
+	if (status != LIBUSB_TRANSFER_COMPLETED) return lf_libusb_error(status);
+	return lf_success;
+}
+
+/* Allocates the transfer ring and takes a reference to the event thread. If this fails, the endpoint only uses blocking transfers. */
+int lf_libusb_start(struct _lf_libusb_context *context) {
+	for (int i = 0; i < LF_USB_TRANSFERS; i ++) {
+		struct _lf_libusb_slot *slot = &context->slots[i];
+		slot->context = context;
+		slot->transfer = libusb_alloc_transfer(0);
+		lf_assert(slot->transfer, failure, E_MALLOC, "Failed to allocate USB transfer.");
+	}
+	pthread_mutex_init(&context->lock, NULL);
+	pthread_cond_init(&context->complete, NULL);
+	int _e = lf_libusb_events_retain(context->context);
+	lf_assert(_e == lf_success, destroy, E_ENDPOINT, "Failed to handle the events of the USB transfer ring.");
+	context->async = true;
+	return lf_success;
+destroy:
+	pthread_cond_destroy(&context->complete);
+	pthread_mutex_destroy(&context->lock);
+failure:
+	for (int i = 0; i < LF_USB_TRANSFERS; i ++) {
+		libusb_free_transfer(context->slots[i].transfer);
+		context->slots[i].transfer = NULL;
+	}
+	return lf_error;
+}
+
 int lf_libusb_configure(struct _lf_endpoint *endpoint, void *_ctx) {
 	return lf_success;
 }
@@ -18,112 +247,269 @@ bool lf_libusb_ready(struct _lf_endpoint *endpoint) {
 
 int lf_libusb_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
 	struct _lf_libusb_context *context = (struct _lf_libusb_context *)endpoint->_ctx;
-	int transferred;
-	int _e;
-	int total = lf_ceiling(length, BULK_IN_SIZE);
-	for (int i = 0; i < total; i ++) {
-		uint8_t data[BULK_OUT_SIZE];
-		if (length >= BULK_OUT_SIZE) {
-			memcpy(data, source, BULK_OUT_SIZE);
-		} else {
-			memcpy(data, source, length);
-		}
-		_e = libusb_bulk_transfer(context->handle, BULK_OUT_ENDPOINT, data, BULK_OUT_SIZE, &transferred, LF_USB_TIMEOUT_MS);
-		if (_e != 0) {
-			if (_e == LIBUSB_ERROR_TIMEOUT) {
-				lf_error_raise(E_TIMEOUT, error_message("The transfer to the device timed out."));
-			} else {
-				lf_error_raise(E_COMMUNICATION, error_message("Error during libusb transfer."));
-			}
-			return lf_error;
-		}
-		source += transferred;
-		length -= transferred;
+	/* Anything larger than a single packet is streamed through the transfer ring. */
+	if (context->async && length > BULK_OUT_SIZE) {
+		return lf_libusb_transfer(context, BULK_OUT_ENDPOINT, source, length);
 	}
-	return lf_success;
+	return lf_libusb_bulk(context, BULK_OUT_ENDPOINT, source, length);
 }
 
 int lf_libusb_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
 	struct _lf_libusb_context *context = (struct _lf_libusb_context *)endpoint->_ctx;
-	int transferred;
-	int _e;
-	int total = lf_ceiling(length, BULK_IN_SIZE);
-	for (int i = 0; i < total; i ++) {
-		uint8_t data[BULK_IN_SIZE];
-		_e = libusb_bulk_transfer(context->handle, BULK_IN_ENDPOINT, data, BULK_IN_SIZE, &transferred, LF_USB_TIMEOUT_MS);
-		if (_e != 0) {
-			if (_e == LIBUSB_ERROR_TIMEOUT) {
-				lf_error_raise(E_TIMEOUT, error_message("The transfer to the device timed out."));
-			} else {
-				lf_error_raise(E_COMMUNICATION, error_message("Error during libusb transfer."));
-			}
-			return lf_error;
-		}
-		if (length >= BULK_IN_SIZE) {
-			memcpy(destination, data, BULK_IN_SIZE);
-		} else {
-			memcpy(destination, data, length);
-		}
-		destination += transferred;
-		length -= transferred;
+	if (context->async && length > BULK_IN_SIZE) {
+		return lf_libusb_transfer(context, BULK_IN_ENDPOINT, destination, length);
 	}
-	return lf_success;
+	return lf_libusb_bulk(context, BULK_IN_ENDPOINT, destination, length);
 }
 
 int lf_libusb_destroy(struct _lf_endpoint *endpoint) {
 	if (endpoint) {
 		struct _lf_libusb_context *context = (struct _lf_libusb_context *)endpoint->_ctx;
-		libusb_close(context->handle);
-		libusb_exit(context->context);
+		if (context->async) {
+			/* No transfer is in flight once a push or pull has returned, so the ring can be freed while other endpoints' events are handled. */
+			for (int i = 0; i < LF_USB_TRANSFERS; i ++) {
+				libusb_free_transfer(context->slots[i].transfer);
+			}
+			pthread_cond_destroy(&context->complete);
+			pthread_mutex_destroy(&context->lock);
+			lf_libusb_events_release();
+		}
+		/* The libusb context is shared by every endpoint found with it, so it is not exited here. */
+		if (context->handle) libusb_close(context->handle);
+		if (context->device) libusb_unref_device(context->device);
 	}
 	return lf_success;
 }
 
+/* The libusb context shared by every USB endpoint and the hotplug thread. */
+struct libusb_context *lf_libusb_context;
+pthread_once_t lf_libusb_once = PTHREAD_ONCE_INIT;
+
+void lf_libusb_init(void) {
+	if (libusb_init(&lf_libusb_context)) {
+		lf_libusb_context = NULL;
+		return;
+	}
+	libusb_set_debug(lf_libusb_context, LIBUSB_LOG_LEVEL_INFO);
+}
+
+/* Opens the device and returns an endpoint that reaches it. */
+struct _lf_endpoint *lf_libusb_endpoint_for_device(struct libusb_context *usb, struct libusb_device *device) {
+	struct _lf_endpoint *endpoint = lf_endpoint_create(lf_libusb_configure,
+													   lf_libusb_ready,
+													   lf_libusb_push,
+													   lf_libusb_pull,
+													   lf_libusb_destroy,
+													   sizeof(struct _lf_libusb_context));
+	lf_assert(endpoint, failure, E_NULL, "Failed to create new libusb endpoint.");
+	/* Retain a reference to the libusb context and give it to the context. */
+	struct _lf_libusb_context *context = (struct _lf_libusb_context *)endpoint->_ctx;
+	context->context = usb;
+	/* Open the device and give it to the context. */
+	int _e = libusb_open(device, &(context->handle));
+	lf_assert(_e == 0, release, E_NO_DEVICE, "Could not find any devices connected via USB. Ensure that a device is connected.");
+	context->device = libusb_ref_device(device);
+	/* Claim the device's control interface. */
+	_e = libusb_claim_interface(context->handle, FMR_INTERFACE);
+	lf_assert(_e == 0, release, E_LIBUSB, "Failed to claim interface on attached device. Please quit any other programs using your device.");
+	/* Large transfers fall back to blocking transfers if the transfer ring cannot be set up. */
+	if (lf_libusb_start(context) != lf_success) lf_error_clear();
+	return endpoint;
+release:
+	lf_endpoint_release(endpoint);
+failure:
+	return NULL;
+}
+
 struct _lf_ll *lf_libusb_endpoints_for_vid_pid(uint16_t vid, uint16_t pid) {
-	struct libusb_context *context = NULL;
 	struct libusb_device **libusb_devices = NULL;
 	struct _lf_ll *endpoints = NULL;
-	int _e = libusb_init(&context);
-	libusb_set_debug(context, LIBUSB_LOG_LEVEL_INFO);
-	lf_assert(_e == 0, failure, E_LIBUSB, "Failed to initialize libusb. Reboot and try again.");
+	pthread_once(&lf_libusb_once, lf_libusb_init);
+	struct libusb_context *usb = lf_libusb_context;
+	lf_assert(usb, failure, E_LIBUSB, "Failed to initialize libusb. Reboot and try again.");
 	/* Walk the device list until all desired devices are attached. */
-	size_t device_count = libusb_get_device_list(context, &libusb_devices);
-	for (size_t i = 0; i < device_count; i ++) {
+	ssize_t device_count = libusb_get_device_list(usb, &libusb_devices);
+	lf_assert(device_count >= 0, failure, E_LIBUSB, "Failed to list the devices connected via USB.");
+	for (ssize_t i = 0; i < device_count; i ++) {
 		struct libusb_device *libusb_device = libusb_devices[i];
 		/* Obtain the device's descriptor. */
 		struct libusb_device_descriptor descriptor;
-		_e = libusb_get_device_descriptor(libusb_device, &descriptor);
-		lf_assert(_e == 0, failure, E_LIBUSB, "Failed to obtain descriptor for device.");
+		int _e = libusb_get_device_descriptor(libusb_device, &descriptor);
+		lf_assert(_e == 0, release, E_LIBUSB, "Failed to obtain descriptor for device.");
 		/* Check if we have a match with the desired VID and PID. */
 		if (descriptor.idVendor == vid && descriptor.idProduct == pid) {
-			/* Create an new endpoint for endpoint device. */
-			struct _lf_endpoint *endpoint = lf_endpoint_create(lf_libusb_configure,
-															   lf_libusb_ready,
-															   lf_libusb_push,
-															   lf_libusb_pull,
-															   lf_libusb_destroy,
-															   sizeof(struct _lf_libusb_context));
-			lf_assert(endpoint, release, E_NULL, "Failed to create new libusb endpoint.");
-			/* Retain a reference to the libusb context and give it to the context. */
-			struct _lf_libusb_context *context = (struct _lf_libusb_context *)endpoint->_ctx;
-			/* Open the device and give it to the context. */
-			_e = libusb_open(libusb_device, &(context->handle));
-			lf_assert(_e == 0, release, E_NO_DEVICE, "Could not find any devices connected via USB. Ensure that a device is connected.");
-			/* Claim the device's control interface. */
-			_e = libusb_claim_interface(context->handle, FMR_INTERFACE);
-			lf_assert(_e == 0, release, E_LIBUSB, "Failed to claim interface on attached device. Please quit any other programs using your device.");
-			lf_assert(_e == 0, release, E_LIBUSB, "Failed to reset the libusb device.");
+			struct _lf_endpoint *endpoint = lf_libusb_endpoint_for_device(usb, libusb_device);
+			if (!endpoint) break;
 			/* Add the device to the device list. */
 			_e = lf_ll_append(&endpoints, endpoint, lf_endpoint_release);
-			lf_assert(_e == 0, release, E_NULL, "Failed to attach device.");
-			continue;
-release:
-			//lf_endpoint_release(endpoint);
-			break;
+			if (_e != lf_success) {
+				lf_endpoint_release(endpoint);
+				break;
+			}
 		}
 	}
+release:
+	/* Each endpoint holds its own reference to its device, so the list can be freed along with the references it holds. */
+	libusb_free_device_list(libusb_devices, 1);
 failure:
-	//libusb_free_device_list(libusb_devices, 1);
-	//libusb_exit(context);
 	return endpoints;
 }
+
+/* A device that arrived or left, waiting to be handled by the hotplug thread. */
+struct _lf_libusb_change {
+	struct libusb_device *device;
+	libusb_hotplug_event event;
+};
+
+struct _lf_libusb_hotplug {
+	libusb_hotplug_callback_handle handle;
+	/* The thread that reports the changes. It is not the event thread, as reporting an arrival talks to the device. */
+	pthread_t thread;
+	volatile int stop;
+	/* The changes that libusb has reported, but that have not been handled yet. */
+	struct _lf_queue *changes;
+	/* The number of changes recorded since the hotplug thread last looked, and what it waits on for more. */
+	uint32_t pending;
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	/* The endpoints created for devices that arrived, so that they can be found when the devices leave. */
+	struct _lf_vector endpoints;
+	lf_libusb_hotplug_func arrived;
+	lf_libusb_hotplug_func left;
+	void *_ctx;
+	bool running;
+} lf_libusb_hotplug = { .lock = PTHREAD_MUTEX_INITIALIZER, .changed = PTHREAD_COND_INITIALIZER };
+
+/* Called by libusb while it handles events, so it only records the change. Opening the device and talking to it happen on the hotplug thread. */
+int lf_libusb_hotplug_callback(libusb_context *usb, libusb_device *device, libusb_hotplug_event event, void *_hotplug) {
+	struct _lf_libusb_hotplug *hotplug = _hotplug;
+	struct _lf_libusb_change *change = malloc(sizeof(struct _lf_libusb_change));
+	lf_assert(change, failure, E_MALLOC, "Failed to allocate memory for a USB hotplug event.");
+	change->device = libusb_ref_device(device);
+	change->event = event;
+	if (!lf_queue_push(hotplug->changes, change)) {
+		libusb_unref_device(device);
+		free(change);
+		lf_error_raise(E_OVERFLOW, error_message("Too many USB devices arrived or left at once. Some were ignored."));
+		goto failure;
+	}
+	pthread_mutex_lock(&hotplug->lock);
+	hotplug->pending ++;
+	pthread_cond_signal(&hotplug->changed);
+	pthread_mutex_unlock(&hotplug->lock);
+failure:
+	/* Keep the callback registered. */
+	return 0;
+}
+
+/* Drops the changes that have not been handled, and frees the queue that holds them. */
+void lf_libusb_hotplug_discard(struct _lf_libusb_hotplug *hotplug) {
+	struct _lf_libusb_change *change;
+	while ((change = lf_queue_pop(hotplug->changes))) {
+		libusb_unref_device(change->device);
+		free(change);
+	}
+	lf_queue_release(hotplug->changes);
+	hotplug->changes = NULL;
+}
+
+/* Creates or finds the endpoint for each device that arrived or left, and reports it. */
+void lf_libusb_hotplug_dispatch(struct _lf_libusb_hotplug *hotplug) {
+	struct _lf_libusb_change *change;
+	while ((change = lf_queue_pop(hotplug->changes))) {
+		if (change->event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
+			struct _lf_endpoint *endpoint = lf_libusb_endpoint_for_device(lf_libusb_context, change->device);
+			if (endpoint) {
+				lf_vector_append(&hotplug->endpoints, endpoint);
+				/* An endpoint that was not kept has been released, and must not be looked at when its device leaves. */
+				if (hotplug->arrived(endpoint, hotplug->_ctx) != lf_success) lf_vector_remove(&hotplug->endpoints, endpoint);
+			}
+		} else {
+			for (uint32_t i = 0; i < lf_vector_count(&hotplug->endpoints); i ++) {
+				struct _lf_endpoint *endpoint = lf_vector_item(&hotplug->endpoints, i);
+				struct _lf_libusb_context *context = (struct _lf_libusb_context *)endpoint->_ctx;
+				if (context->device != change->device) continue;
+				lf_vector_remove(&hotplug->endpoints, endpoint);
+				hotplug->left(endpoint, hotplug->_ctx);
+				break;
+			}
+		}
+		libusb_unref_device(change->device);
+		free(change);
+	}
+}
+
+/* Reports the changes recorded on the event thread. Sleeps until there are some, rather than waking up to check whether to stop. */
+void *lf_libusb_hotplug_thread(void *_hotplug) {
+	struct _lf_libusb_hotplug *hotplug = _hotplug;
+	pthread_mutex_lock(&hotplug->lock);
+	while (!hotplug->stop) {
+		if (!hotplug->pending) {
+			pthread_cond_wait(&hotplug->changed, &hotplug->lock);
+			continue;
+		}
+		hotplug->pending = 0;
+		pthread_mutex_unlock(&hotplug->lock);
+		lf_libusb_hotplug_dispatch(hotplug);
+		pthread_mutex_lock(&hotplug->lock);
+	}
+	pthread_mutex_unlock(&hotplug->lock);
+	return NULL;
+}
+
+/* Stops the hotplug thread, leaving the changes it has not reported in the queue. */
+void lf_libusb_hotplug_join(struct _lf_libusb_hotplug *hotplug) {
+	pthread_mutex_lock(&hotplug->lock);
+	hotplug->stop = 1;
+	pthread_cond_signal(&hotplug->changed);
+	pthread_mutex_unlock(&hotplug->lock);
+	pthread_join(hotplug->thread, NULL);
+}
+
+int lf_libusb_hotplug_start(uint16_t vid, uint16_t pid, lf_libusb_hotplug_func arrived, lf_libusb_hotplug_func left, void *_ctx) {
+	struct _lf_libusb_hotplug *hotplug = &lf_libusb_hotplug;
+	lf_assert(arrived && left, failure, E_NULL, "Invalid hotplug callback provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_assert(!hotplug->running, failure, E_CONFIGURATION, "USB hotplug is already running.");
+	pthread_once(&lf_libusb_once, lf_libusb_init);
+	lf_assert(lf_libusb_context, failure, E_LIBUSB, "Failed to initialize libusb. Reboot and try again.");
+	lf_assert(libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG), failure, E_UNIMPLEMENTED, "USB hotplug is not supported on this platform.");
+	hotplug->changes = lf_queue_create(LF_USB_HOTPLUG_EVENTS);
+	lf_assert(hotplug->changes, failure, E_MALLOC, "Failed to allocate the USB hotplug event queue.");
+	hotplug->arrived = arrived;
+	hotplug->left = left;
+	hotplug->_ctx = _ctx;
+	hotplug->stop = 0;
+	hotplug->pending = 0;
+	/* Devices that are already connected are reported as having arrived. */
+	int _e = libusb_hotplug_register_callback(lf_libusb_context, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT, LIBUSB_HOTPLUG_ENUMERATE, vid, pid, LIBUSB_HOTPLUG_MATCH_ANY, lf_libusb_hotplug_callback, hotplug, &hotplug->handle);
+	lf_assert(_e == LIBUSB_SUCCESS, release, E_LIBUSB, "Failed to register for USB hotplug events.");
+	_e = pthread_create(&hotplug->thread, NULL, lf_libusb_hotplug_thread, hotplug);
+	lf_assert(_e == 0, deregister, E_LIBUSB, "Failed to start the USB hotplug thread.");
+	/* Later changes are recorded by the event thread shared with the endpoints. */
+	_e = lf_libusb_events_retain(lf_libusb_context);
+	lf_assert(_e == lf_success, join, E_LIBUSB, "Failed to handle USB hotplug events.");
+	hotplug->running = true;
+	return lf_success;
+join:
+	lf_libusb_hotplug_join(hotplug);
+deregister:
+	libusb_hotplug_deregister_callback(lf_libusb_context, hotplug->handle);
+release:
+	lf_libusb_hotplug_discard(hotplug);
+failure:
+	return lf_error;
+}
+
+int lf_libusb_hotplug_stop(void) {
+	struct _lf_libusb_hotplug *hotplug = &lf_libusb_hotplug;
+	if (!hotplug->running) return lf_success;
+	/* No more changes are recorded once the callback is gone. */
+	libusb_hotplug_deregister_callback(lf_libusb_context, hotplug->handle);
+	lf_libusb_events_release();
+	lf_libusb_hotplug_join(hotplug);
+	lf_libusb_hotplug_discard(hotplug);
+	/* The endpoints themselves belong to whoever they were reported to. */
+	lf_vector_release(&hotplug->endpoints);
+	hotplug->running = false;
+	return lf_success;
+}
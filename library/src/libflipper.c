@@ -1,9 +1,19 @@
 #include <flipper.h>
+#include <flipper/atomic.h>
 
-lf_device_list lf_attached_devices;
+lf_device_list lf_attached_devices = LF_VECTOR(lf_device_release);
+struct _lf_lock lf_attached_lock;
 struct _lf_device *lf_current_device;
 lf_event_list lf_registered_events;
 
+/* The device selected by this thread, and the number of detaches there had been when it was selected. */
+LF_THREAD_LOCAL struct _lf_device *lf_selected_device;
+LF_THREAD_LOCAL uint32_t lf_selected_detaches;
+/* The number of devices detached so far, so that a thread can tell that the device it selected may be gone. */
+uint32_t lf_detaches;
+/* The device whose selector is running on this thread. */
+LF_THREAD_LOCAL struct _lf_device *lf_routing_device;
+
 /* Creates a new libflipper device. */
 struct _lf_device *lf_device_create(struct _lf_endpoint *endpoint, int (* select)(struct _lf_device *device), int (* destroy)(struct _lf_device *device), size_t context_size) {
 	struct _lf_device *device = (struct _lf_device *)calloc(1, sizeof(struct _lf_device));
@@ -12,22 +22,78 @@ struct _lf_device *lf_device_create(struct _lf_endpoint *endpoint, int (* select
 	device->select = select;
 	device->destroy = destroy;
 	device->_ctx = calloc(1, context_size);
+	/* Default to waiting for each result before sending the next invocation. */
+	device->window = 1;
+	/* Every device accepts frames of the base packet size. */
+	device->frame_size = FMR_PACKET_SIZE;
+	/* The loaded modules are retrieved on first use. */
+	device->module_count = -1;
+	/* The reference held by the creator, which is handed to the attached devices on attach. */
+	device->references = 1;
 	return device;
 failure:
 	free(device);
 	return NULL;
 }
 
+struct _lf_device *lf_set_thread_device(struct _lf_device *device) {
+	struct _lf_device *previous = lf_selected_device;
+	lf_selected_device = device;
+	lf_selected_detaches = lf_atomic_load(&lf_detaches);
+	return previous;
+}
+
 void lf_set_current_device(struct _lf_device *device) {
-	lf_current_device = device;
+	lf_set_thread_device(device);
+	/* Taken so that a detach cannot clear the selection between its check and its store. */
+	lf_lock(&lf_attached_lock);
+	lf_atomic_store_pointer((void **)&lf_current_device, device);
+	lf_unlock(&lf_attached_lock);
 }
 
 struct _lf_device *lf_get_current_device(void) {
-	return lf_current_device;
+	struct _lf_device *device = lf_selected_device;
+	if (!device) return lf_atomic_load_pointer((void **)&lf_current_device);
+	/* If any device has been detached since this thread made its selection, make sure that it was not this one. */
+	uint32_t detaches = lf_atomic_load(&lf_detaches);
+	if (detaches != lf_selected_detaches) {
+		lf_lock(&lf_attached_lock);
+		bool attached = lf_vector_contains(&lf_attached_devices, device);
+		lf_unlock(&lf_attached_lock);
+		lf_selected_detaches = detaches;
+		if (!attached) {
+			lf_selected_device = NULL;
+			return lf_atomic_load_pointer((void **)&lf_current_device);
+		}
+	}
+	return device;
+}
+
+void lf_route(struct _lf_module *module, struct _lf_device *device, int index) {
+	struct _lf_device *routing = lf_routing_device;
+	lf_assert(routing, failure, E_NULL, "The module '%s' can only be routed by a selector.", module->name);
+	/* A later route for the same module replaces the earlier one. */
+	struct _lf_route *route = routing->routes;
+	while (route < routing->routes + routing->route_count && route->module != module) route ++;
+	if (route == routing->routes + routing->route_count) {
+		lf_assert(routing->route_count < LF_MAX_ROUTES, failure, E_OVERFLOW, "The device '%s' routes more than %i modules.", routing->configuration.name, LF_MAX_ROUTES);
+		routing->route_count ++;
+	}
+	route->module = module;
+	route->device = device;
+	route->index = index;
+failure:
+	return;
+}
+
+struct _lf_device *lf_device_retain(struct _lf_device *device) {
+	if (device) lf_atomic_add(&device->references, 1);
+	return device;
 }
 
 int lf_device_release(struct _lf_device *device) {
-	if (device) {
+	/* A device that is detached while a call is in progress on it is released once the call is done. */
+	if (device && lf_atomic_add(&device->references, (uint32_t)-1) == 0) {
 		lf_endpoint_release(device->endpoint);
 		if (device->destroy) device->destroy(device);
 		free(device->_ctx);
@@ -39,18 +105,79 @@ int lf_device_release(struct _lf_device *device) {
 /* Attempts to attach to all unattached devices. Returns how many devices were attached. */
 int lf_attach(struct _lf_device *device) {
 	lf_assert(device, failure, E_NULL, "Attempt to attach an invalid device.");
-	lf_ll_append(&lf_attached_devices, device, lf_device_release);
+	/* Slow the device down to the link described by the environment, if any. */
+	device->endpoint = lf_link_endpoint_from_env(device->endpoint);
+	/* Record what the device is sent and what it answers, as the host sees it, if asked to. */
+	device->endpoint = lf_record_endpoint_from_env(device->endpoint);
+	/* Route the device's modules before any other thread can see it, so that the routes never change under an invocation. */
+	if (device->select) {
+		lf_routing_device = device;
+		device->select(device);
+		lf_routing_device = NULL;
+	}
+	/* The attached devices take over the caller's reference. Another is held until the device is set up, in case another thread detaches it first. */
+	lf_device_retain(device);
+	lf_lock(&lf_attached_lock);
+	int _e = lf_vector_append(&lf_attached_devices, device);
+	lf_unlock(&lf_attached_lock);
+	lf_assert(_e == lf_success, release, E_MALLOC, "Failed to add device '%s' to the attached devices.", device->configuration.name);
 	lf_select(device);
+	/* Negotiate the fastest protocol features that the device supports. */
+	lf_load_configuration(device);
+	/* Retrieve the loaded modules up front so that binding to them does not require a call to the device. */
+	if (device->configuration.capabilities & lf_capability_modules) {
+		if (lf_load_modules(device) != lf_success) lf_error_clear();
+	}
+	/* Wake the event loop when the device has something to say. */
+	lf_reactor_register(device);
+	lf_device_release(device);
 	return lf_success;
+release:
+	lf_device_release(device);
 failure:
 	return lf_error;
 }
 
-/* Call's the device's selector function and selects the device. */
+/* Selects the device for the calling thread. Modules without a device of their own are invoked through it. */
 int lf_select(struct _lf_device *device) {
 	lf_assert(device, failure, E_NULL, "NULL device pointer provided for selection.");
-	device->select(device);
 	lf_set_current_device(device);
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+/* Sets the number of invocations that may be outstanding on the device at once. */
+int lf_set_window(struct _lf_device *device, uint8_t window) {
+	lf_assert(device, failure, E_NULL, "NULL device pointer provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_assert(window > 0 && window <= LF_MAX_OUTSTANDING, failure, E_OVERFLOW, "The window for device '%s' must be between 1 and %i.", device->configuration.name, LF_MAX_OUTSTANDING);
+	/* Devices that reported their configuration also bound the window. */
+	lf_assert(!device->configuration.window || window <= device->configuration.window, failure, E_OVERFLOW, "The device '%s' accepts at most %i outstanding invocations.", device->configuration.name, device->configuration.window);
+	lf_lock(&device->lock);
+	/* Shrinking the window requires the excess results to be retrieved first. */
+	if (device->outstanding > window) {
+		int _e = lf_drain(device);
+		lf_assert(_e == lf_success, release, E_FMR, "Failed to drain device '%s' while resizing its window.", device->configuration.name);
+	}
+	device->window = window;
+	lf_unlock(&device->lock);
+	return lf_success;
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+/* Sets whether invocations returning 'lf_void_t' are sent without waiting for a reply. */
+int lf_set_deferred(struct _lf_device *device, bool deferred) {
+	lf_assert(device, failure, E_NULL, "NULL device pointer provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_assert(!deferred || (device->configuration.capabilities & lf_capability_deferred), failure, E_CONFIGURATION, "The device '%s' does not support invocations without a reply.", device->configuration.name);
+	lf_lock(&device->lock);
+	device->deferred = deferred;
+	/* Report the failures of the invocations already sent without a reply. */
+	int _e = (!deferred && device->unsynced) ? lf_sync(device) : lf_success;
+	lf_unlock(&device->lock);
+	return _e;
 failure:
 	return lf_error;
 }
@@ -58,7 +185,16 @@ failure:
 /* Detaches a device from libflipper. */
 int lf_detach(struct _lf_device *device) {
 	lf_assert(device, failure, E_NULL, "Invalid device provided to detach.");
-	lf_ll_remove(&lf_attached_devices, device);
+	lf_reactor_unregister(device);
+	lf_lock(&lf_attached_lock);
+	/* Calls routed through the current device must not reach a device that has been released. */
+	if (lf_selected_device == device) lf_selected_device = NULL;
+	if (lf_current_device == device) lf_atomic_store_pointer((void **)&lf_current_device, NULL);
+	/* Threads that selected the device find that it is gone once they see the count change. */
+	lf_atomic_add(&lf_detaches, 1);
+	/* This drops the reference held by the attached devices. Calls still in progress on the device hold their own, so it outlives them. */
+	lf_vector_remove(&lf_attached_devices, device);
+	lf_unlock(&lf_attached_lock);
 	return lf_success;
 failure:
 	return lf_error;
@@ -67,10 +203,134 @@ failure:
 /* Deactivates libflipper state and releases the event loop. */
 int __attribute__((__destructor__)) lf_exit(void) {
 	/* Release all of the libflipper events. */
-	lf_ll_release(&lf_get_event_list());
+	lf_event_table_release(&lf_get_event_list());
 	/* Release all of the attached devices. */
-	lf_ll_release(&lf_attached_devices);
+	lf_lock(&lf_attached_lock);
+	lf_vector_release(&lf_attached_devices);
+	lf_unlock(&lf_attached_lock);
+	return lf_success;
+}
+
+int lf_load_modules(struct _lf_device *device) {
+	lf_assert(device, failure, E_NULL, "NULL device passed to '%s'.", __PRETTY_FUNCTION__);
+	lf_assert(device->configuration.capabilities & lf_capability_modules, failure, E_CONFIGURATION, "The device '%s' does not report its loaded modules.", device->configuration.name);
+	lf_lock(&device->lock);
+	lf_crc_t modules[LF_MAX_MODULES];
+	memset(modules, 0, sizeof(modules));
+	/* The loader is invoked through the thread's selection, so the device is selected for the call. */
+	struct _lf_device *selected = lf_selected_device;
+	uint32_t detaches = lf_selected_detaches;
+	lf_set_thread_device(device);
+	int count = fld_table(modules, sizeof(modules));
+	/* The selection is restored as it was made, so that a detach since then is still noticed. */
+	lf_selected_device = selected;
+	lf_selected_detaches = detaches;
+	lf_assert(count != lf_error, release, E_MODULE, "Failed to retrieve the modules loaded on the device '%s'.", device->configuration.name);
+	memcpy(device->modules, modules, sizeof(modules));
+	device->module_count = count;
+	lf_unlock(&device->lock);
 	return lf_success;
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+/* Looks a module up on the device itself. The loader is invoked through the thread's selection, so the device is selected for the call. */
+int lf_module_find(struct _lf_device *device, lf_crc_t identifier) {
+	struct _lf_device *selected = lf_selected_device;
+	uint32_t detaches = lf_selected_detaches;
+	lf_set_thread_device(device);
+	int index = fld_index(identifier);
+	lf_selected_device = selected;
+	lf_selected_detaches = detaches;
+	return index;
+}
+
+/* Finds the index of a module on the device, using the device's cached module table when it can. */
+int lf_module_index(struct _lf_device *device, lf_crc_t identifier) {
+	if (!(device->configuration.capabilities & lf_capability_modules)) return lf_module_find(device, identifier);
+	/* The table is searched under the lock, so that a load on another thread cannot replace it mid search. */
+	lf_lock(&device->lock);
+	int index = -1;
+	if (device->module_count < 0 && lf_load_modules(device) != lf_success) {
+		index = lf_module_find(device, identifier);
+		goto done;
+	}
+	int cached = (device->module_count < LF_MAX_MODULES) ? device->module_count : LF_MAX_MODULES;
+	for (int i = 0; i < cached; i ++) {
+		if (device->modules[i] == identifier) {
+			index = i;
+			goto done;
+		}
+	}
+	/* Modules past the end of the cache must be looked up on the device. */
+	if (device->module_count > LF_MAX_MODULES) index = lf_module_find(device, identifier);
+done:
+	lf_unlock(&device->lock);
+	return index;
+}
+
+/* Finds the index of the module's counterpart on the device, loading the module onto the device if it is not there. */
+int lf_module_locate(struct _lf_module *module, struct _lf_device *device) {
+	lf_assert(module->name, failure, E_MODULE, "Module has no name.");
+	lf_crc_t identifier = (module->identifier) ? module->identifier : lf_crc(module->name, strlen(module->name) + 1);
+	int index = lf_module_index(device, identifier);
+	if (index == -1) {
+		lf_debug("Could not find counterpart for '%s'. Attempting to load it.", module->name);
+		lf_load(module->data, *module->psize, device);
+		index = lf_module_index(device, identifier);
+	}
+	lf_assert(index != -1, failure, E_MODULE, "No counterpart for the module '%s' was found on the device '%s'. Load the module first.", module->name, device->configuration.name);
+	return index | FMR_USER_INVOCATION_BIT;
+failure:
+	return lf_error;
+}
+
+struct _lf_device *lf_resolve(struct _lf_module *module, struct _lf_device *device, int *index) {
+	*index = module->index;
+	/* The device is found and retained under the lock, so that it cannot be detached and released in between. */
+	lf_lock(&lf_attached_lock);
+	/* Modules bound to a device are always invoked on it. */
+	if (module->device) {
+		device = module->device;
+	} else {
+		if (!device) device = lf_get_current_device();
+		lf_assert(device, unlock, E_NO_DEVICE, "The module '%s' has no target device. Did you attach?", module->name);
+		for (struct _lf_route *route = device->routes; route < device->routes + device->route_count; route ++) {
+			if (route->module != module) continue;
+			device = route->device;
+			*index = route->index;
+			break;
+		}
+	}
+	lf_device_retain(device);
+	lf_unlock(&lf_attached_lock);
+	/* Modules that were not given an index are found on each device, as each device may have them at a different index. */
+	if (*index == -1) {
+		lf_lock(&device->lock);
+		uint8_t loads = device->loads;
+		for (struct _lf_route *route = device->located; route < device->located + device->located_count; route ++) {
+			if (route->module == module) *index = route->index;
+		}
+		lf_unlock(&device->lock);
+		if (*index != -1) return device;
+		*index = lf_module_locate(module, device);
+		lf_assert(*index != lf_error, release, E_MODULE, "Failed to find the module '%s' on the device '%s'.", module->name, device->configuration.name);
+		/* Remember where the module was found, unless an image was loaded in the meantime. Devices that do not report their modules would otherwise be asked on every call. */
+		lf_lock(&device->lock);
+		if (device->loads == loads && device->located_count < LF_MAX_MODULES) {
+			device->located[device->located_count ++] = (struct _lf_route){ module, device, *index };
+		}
+		lf_unlock(&device->lock);
+	}
+	return device;
+release:
+	lf_device_release(device);
+	return NULL;
+unlock:
+	lf_unlock(&lf_attached_lock);
+	return NULL;
 }
 
 /* Binds the lf_module structure to its counterpart on the attached device. */
@@ -79,16 +339,11 @@ LF_WEAK int lf_bind(struct _lf_module *module, struct _lf_device *device) {
 	lf_assert(device, failure, E_NULL, "NULL device passed to '%s'.", __PRETTY_FUNCTION__)
 	lf_assert(module->name, failure, E_MODULE, "Module has no name.");
 	lf_debug("Binding to module '%s'.", module->name);
-	module->device = device;
 	module->identifier = lf_crc(module->name, strlen(module->name) + 1);
-	int index = fld_index(module->identifier);
-	if (index == -1) {
-		lf_debug("Could not find counterpart for '%s'. Attempting to load it.", module->name);
-		lf_load(module->data, *module->psize, module->device);
-		index = fld_index(module->identifier);
-	}
-	lf_assert(index != -1, failure, E_MODULE, "No counterpart for the module '%s' was found on the device '%s'. Load the module first.", module->name, module->device->configuration.name);
-	module->index = index | FMR_USER_INVOCATION_BIT;
+	int index = lf_module_locate(module, device);
+	lf_assert(index != lf_error, failure, E_MODULE, "Failed to bind the module '%s' to the device '%s'.", module->name, device->configuration.name);
+	module->device = device;
+	module->index = index;
 	return lf_success;
 failure:
 	return lf_error;
@@ -133,10 +388,14 @@ void lf_debug_packet(struct _fmr_packet *packet, size_t length) {
 		printf("\t└─ magic:\t\t0x%x\n", packet->header.magic);
 		printf("\t└─ checksum:\t0x%x\n", packet->header.checksum);
 		printf("\t└─ length:\t\t%d bytes (%.02f%%)\n", packet->header.length, (float) packet->header.length/sizeof(struct _fmr_packet)*100);
-		char *classstrs[] = { "standard", "user", "push", "pull", "send", "receive", "load", "event" };
+		char *classstrs[] = { "standard", "user", "push", "pull", "send", "receive", "load", "event", "batch", "inline push", "inline pull", "sync", "configuration" };
 		printf("\t└─ class\t\t%s\n", classstrs[packet->header.type]);
+		printf("\t└─ sequence:\t%i\n", packet->header.sequence);
+		printf("\t└─ flags:\t\t0x%x\n", packet->header.flags);
 		struct _fmr_invocation_packet *invocation = (struct _fmr_invocation_packet *)(packet);
 		struct _fmr_push_pull_packet *pushpull = (struct _fmr_push_pull_packet *)(packet);
+		struct _fmr_batch_packet *batch = (struct _fmr_batch_packet *)(packet);
+		uint8_t *offset = batch->entries;
 		switch (packet->header.type) {
 			case fmr_standard_invocation_class:
 				lf_debug_call(&invocation->call);
@@ -146,10 +405,25 @@ void lf_debug_packet(struct _fmr_packet *packet, size_t length) {
 			break;
 			case fmr_push_class:
 			case fmr_pull_class:
+			case fmr_inline_push_class:
+			case fmr_inline_pull_class:
 				printf("length:\n");
 				printf("\t└─ length:\t\t0x%x\n", pushpull->length);
 				lf_debug_call(&pushpull->call);
 			break;
+			case fmr_batch_class:
+				printf("batch:\n");
+				printf("\t└─ count:\t\t%i\n", batch->count);
+				for (uint8_t i = 0; i < batch->count; i ++) {
+					struct _fmr_batch_entry *entry = (struct _fmr_batch_entry *)offset;
+					lf_debug_call(&entry->call);
+					offset = entry->call.parameters + fmr_parameters_size(&entry->call);
+				}
+			break;
+			case fmr_sync_class:
+			case fmr_configuration_class:
+				/* These packets carry only a header. */
+			break;
 			default:
 				printf("Invalid packet class.\n");
 			break;
@@ -170,5 +444,6 @@ void lf_debug_result(struct _fmr_result *result) {
 	printf("response:\n");
 	printf("\t└─ value:\t0x%x\n", result->value);
 	printf("\t└─ error:\t0x%hhx\n", result->error);
+	printf("\t└─ sequence:\t%i\n", result->sequence);
 	printf("\n-----------\n\n");
 }
@@ -0,0 +1,140 @@
+/* fmr.c - Dispatches message runtime calls following the ARM procedure call standard. */
+
+#include <flipper.h>
+
+/* Arguments are passed in 32-bit words, the first four in r0-r3 and the rest on the stack. */
+typedef uint32_t fmr_word;
+
+/* Each argument takes at most two words, and a 64-bit argument may be preceded by a padding word. */
+#define FMR_MAX_WORDS (sizeof(lf_types) * 4)
+
+/* The argument lists and prototypes of the trampolines below. */
+#define FMR_WORDS_0
+#define FMR_WORDS_1 w[0]
+#define FMR_WORDS_2 FMR_WORDS_1, w[1]
+#define FMR_WORDS_3 FMR_WORDS_2, w[2]
+#define FMR_WORDS_4 FMR_WORDS_3, w[3]
+#define FMR_WORDS_5 FMR_WORDS_4, w[4]
+#define FMR_WORDS_6 FMR_WORDS_5, w[5]
+#define FMR_WORDS_7 FMR_WORDS_6, w[6]
+#define FMR_WORDS_8 FMR_WORDS_7, w[7]
+#define FMR_WORDS_9 FMR_WORDS_8, w[8]
+#define FMR_WORDS_10 FMR_WORDS_9, w[9]
+#define FMR_WORDS_11 FMR_WORDS_10, w[10]
+#define FMR_WORDS_12 FMR_WORDS_11, w[11]
+#define FMR_WORDS_13 FMR_WORDS_12, w[12]
+#define FMR_WORDS_14 FMR_WORDS_13, w[13]
+#define FMR_WORDS_15 FMR_WORDS_14, w[14]
+#define FMR_WORDS_16 FMR_WORDS_15, w[15]
+
+#define FMR_PROTOTYPE_0 void
+#define FMR_PROTOTYPE_1 fmr_word
+#define FMR_PROTOTYPE_2 FMR_PROTOTYPE_1, fmr_word
+#define FMR_PROTOTYPE_3 FMR_PROTOTYPE_2, fmr_word
+#define FMR_PROTOTYPE_4 FMR_PROTOTYPE_3, fmr_word
+#define FMR_PROTOTYPE_5 FMR_PROTOTYPE_4, fmr_word
+#define FMR_PROTOTYPE_6 FMR_PROTOTYPE_5, fmr_word
+#define FMR_PROTOTYPE_7 FMR_PROTOTYPE_6, fmr_word
+#define FMR_PROTOTYPE_8 FMR_PROTOTYPE_7, fmr_word
+#define FMR_PROTOTYPE_9 FMR_PROTOTYPE_8, fmr_word
+#define FMR_PROTOTYPE_10 FMR_PROTOTYPE_9, fmr_word
+#define FMR_PROTOTYPE_11 FMR_PROTOTYPE_10, fmr_word
+#define FMR_PROTOTYPE_12 FMR_PROTOTYPE_11, fmr_word
+#define FMR_PROTOTYPE_13 FMR_PROTOTYPE_12, fmr_word
+#define FMR_PROTOTYPE_14 FMR_PROTOTYPE_13, fmr_word
+#define FMR_PROTOTYPE_15 FMR_PROTOTYPE_14, fmr_word
+#define FMR_PROTOTYPE_16 FMR_PROTOTYPE_15, fmr_word
+
+/* Calls a function with a fixed number of argument words. A 64-bit result is returned in r0 and r1. */
+#define FMR_TRAMPOLINE(n) \
+	uint64_t fmr_trampoline_##n(lf_return_t (* function)(void), const fmr_word *w) { \
+		return ((uint64_t (*)(FMR_PROTOTYPE_##n))(void (*)(void))function)(FMR_WORDS_##n); \
+	}
+
+FMR_TRAMPOLINE(0)
+FMR_TRAMPOLINE(1)
+FMR_TRAMPOLINE(2)
+FMR_TRAMPOLINE(3)
+FMR_TRAMPOLINE(4)
+FMR_TRAMPOLINE(5)
+FMR_TRAMPOLINE(6)
+FMR_TRAMPOLINE(7)
+FMR_TRAMPOLINE(8)
+FMR_TRAMPOLINE(9)
+FMR_TRAMPOLINE(10)
+FMR_TRAMPOLINE(11)
+FMR_TRAMPOLINE(12)
+FMR_TRAMPOLINE(13)
+FMR_TRAMPOLINE(14)
+FMR_TRAMPOLINE(15)
+FMR_TRAMPOLINE(16)
+
+/* The trampolines, indexed by the number of argument words they pass. */
+uint64_t (*const fmr_trampolines[FMR_MAX_WORDS + 1])(lf_return_t (* function)(void), const fmr_word *w) = {
+	fmr_trampoline_0,
+	fmr_trampoline_1,
+	fmr_trampoline_2,
+	fmr_trampoline_3,
+	fmr_trampoline_4,
+	fmr_trampoline_5,
+	fmr_trampoline_6,
+	fmr_trampoline_7,
+	fmr_trampoline_8,
+	fmr_trampoline_9,
+	fmr_trampoline_10,
+	fmr_trampoline_11,
+	fmr_trampoline_12,
+	fmr_trampoline_13,
+	fmr_trampoline_14,
+	fmr_trampoline_15,
+	fmr_trampoline_16
+};
+
+lf_return_t fmr_call(lf_return_t (* function)(void), lf_type ret, uint8_t argc, lf_types argt, void *argv) {
+	lf_assert(argc <= sizeof(lf_types) * 2, failure, E_OVERFLOW, "Too many arguments (%i) were provided to '%s'.", argc, __PRETTY_FUNCTION__);
+	lf_assert(ret <= lf_max_t && ((1 << ret) & FMR_RET_TYPES), failure, E_TYPE, "An invalid return type (%i) was provided to '%s'.", ret, __PRETTY_FUNCTION__);
+
+	/* Lay the arguments out in the words they would occupy across the argument registers and the stack. */
+	fmr_word words[FMR_MAX_WORDS];
+	uint8_t count = 0;
+	uint8_t *arg = argv;
+	for (uint8_t i = 0; i < argc; i ++) {
+		/* The parameters are packed, so wider values are copied rather than loaded in place. */
+		uint16_t half;
+		switch (argt & lf_max_t) {
+			case lf_uint8_t: words[count ++] = *(uint8_t *)arg; arg += sizeof(uint8_t); break;
+			case lf_int8_t: words[count ++] = *(int8_t *)arg; arg += sizeof(int8_t); break;
+			case lf_uint16_t: memcpy(&half, arg, sizeof(uint16_t)); words[count ++] = half; arg += sizeof(uint16_t); break;
+			case lf_int16_t: memcpy(&half, arg, sizeof(uint16_t)); words[count ++] = (int16_t)half; arg += sizeof(int16_t); break;
+			case lf_uint32_t:
+			case lf_int32_t: memcpy(&words[count ++], arg, sizeof(uint32_t)); arg += sizeof(uint32_t); break;
+			/* Integers and pointers are encoded in 8 bytes, but only the low 4 are used. */
+			case lf_int_t:
+			case lf_ptr_t: memcpy(&words[count ++], arg, sizeof(uint32_t)); arg += sizeof(uint64_t); break;
+			case lf_uint64_t:
+			case lf_int64_t:
+				/* A 64-bit argument starts at an even register or a doubleword aligned stack slot. */
+				count += count & 1;
+				memcpy(&words[count], arg, sizeof(uint64_t));
+				count += 2;
+				arg += sizeof(uint64_t);
+			break;
+			default: lf_assert(false, failure, E_TYPE, "An invalid type (%i) was provided for argument %i.", argt & lf_max_t, i);
+		}
+		argt >>= 4;
+	}
+
+	uint64_t value = fmr_trampolines[count](function, words);
+
+	/* Only the bits of the return type are defined. */
+	switch (ret) {
+		case lf_void_t: return 0;
+		case lf_uint8_t: return (uint8_t)value;
+		case lf_uint16_t: return (uint16_t)value;
+		case lf_int8_t: return (int8_t)value;
+		case lf_int16_t: return (int16_t)value;
+		default: return (lf_return_t)value;
+	}
+failure:
+	return lf_error;
+}
@@ -0,0 +1,99 @@
+/* fmr.c - Dispatches message runtime calls following the System V AMD64 calling convention. */
+
+#include <flipper.h>
+
+/* Every integer argument occupies a single register or stack slot, so calls differ only in their number of arguments. */
+typedef uint64_t fmr_word;
+
+/* The largest number of arguments whose types can be encoded into a call. */
+#define FMR_MAX_WORDS (sizeof(lf_types) * 2)
+
+/* The argument lists and prototypes of the trampolines below. */
+#define FMR_WORDS_0
+#define FMR_WORDS_1 w[0]
+#define FMR_WORDS_2 FMR_WORDS_1, w[1]
+#define FMR_WORDS_3 FMR_WORDS_2, w[2]
+#define FMR_WORDS_4 FMR_WORDS_3, w[3]
+#define FMR_WORDS_5 FMR_WORDS_4, w[4]
+#define FMR_WORDS_6 FMR_WORDS_5, w[5]
+#define FMR_WORDS_7 FMR_WORDS_6, w[6]
+#define FMR_WORDS_8 FMR_WORDS_7, w[7]
+
+#define FMR_PROTOTYPE_0 void
+#define FMR_PROTOTYPE_1 fmr_word
+#define FMR_PROTOTYPE_2 FMR_PROTOTYPE_1, fmr_word
+#define FMR_PROTOTYPE_3 FMR_PROTOTYPE_2, fmr_word
+#define FMR_PROTOTYPE_4 FMR_PROTOTYPE_3, fmr_word
+#define FMR_PROTOTYPE_5 FMR_PROTOTYPE_4, fmr_word
+#define FMR_PROTOTYPE_6 FMR_PROTOTYPE_5, fmr_word
+#define FMR_PROTOTYPE_7 FMR_PROTOTYPE_6, fmr_word
+#define FMR_PROTOTYPE_8 FMR_PROTOTYPE_7, fmr_word
+
+/* Calls a function with a fixed number of arguments. The compiler places the arguments past the sixth on the stack. */
+#define FMR_TRAMPOLINE(n) \
+	fmr_word fmr_trampoline_##n(lf_return_t (* function)(void), const fmr_word *w) { \
+		return ((fmr_word (*)(FMR_PROTOTYPE_##n))(void (*)(void))function)(FMR_WORDS_##n); \
+	}
+
+FMR_TRAMPOLINE(0)
+FMR_TRAMPOLINE(1)
+FMR_TRAMPOLINE(2)
+FMR_TRAMPOLINE(3)
+FMR_TRAMPOLINE(4)
+FMR_TRAMPOLINE(5)
+FMR_TRAMPOLINE(6)
+FMR_TRAMPOLINE(7)
+FMR_TRAMPOLINE(8)
+
+/* The trampolines, indexed by the number of argument words they pass. */
+fmr_word (*const fmr_trampolines[FMR_MAX_WORDS + 1])(lf_return_t (* function)(void), const fmr_word *w) = {
+	fmr_trampoline_0,
+	fmr_trampoline_1,
+	fmr_trampoline_2,
+	fmr_trampoline_3,
+	fmr_trampoline_4,
+	fmr_trampoline_5,
+	fmr_trampoline_6,
+	fmr_trampoline_7,
+	fmr_trampoline_8
+};
+
+lf_return_t fmr_call(lf_return_t (* function)(void), lf_type ret, uint8_t argc, lf_types argt, void *argv) {
+	lf_assert(argc <= FMR_MAX_WORDS, failure, E_OVERFLOW, "Too many arguments (%i) were provided to '%s'.", argc, __PRETTY_FUNCTION__);
+	lf_assert(ret <= lf_max_t && ((1 << ret) & FMR_RET_TYPES), failure, E_TYPE, "An invalid return type (%i) was provided to '%s'.", ret, __PRETTY_FUNCTION__);
+
+	/* Widen each argument to a full register, extending signed types. */
+	fmr_word words[FMR_MAX_WORDS];
+	uint8_t *arg = argv;
+	for (uint8_t i = 0; i < argc; i ++) {
+		/* The parameters are packed, but this architecture permits unaligned loads. */
+		switch (argt & lf_max_t) {
+			case lf_uint8_t: words[i] = *(uint8_t *)arg; arg += sizeof(uint8_t); break;
+			case lf_int8_t: words[i] = *(int8_t *)arg; arg += sizeof(int8_t); break;
+			case lf_uint16_t: words[i] = *(uint16_t *)arg; arg += sizeof(uint16_t); break;
+			case lf_int16_t: words[i] = *(int16_t *)arg; arg += sizeof(int16_t); break;
+			case lf_uint32_t: words[i] = *(uint32_t *)arg; arg += sizeof(uint32_t); break;
+			case lf_int32_t: words[i] = *(int32_t *)arg; arg += sizeof(int32_t); break;
+			case lf_uint64_t:
+			case lf_int64_t:
+			case lf_int_t:
+			case lf_ptr_t: words[i] = *(uint64_t *)arg; arg += sizeof(uint64_t); break;
+			default: lf_assert(false, failure, E_TYPE, "An invalid type (%i) was provided for argument %i.", argt & lf_max_t, i);
+		}
+		argt >>= 4;
+	}
+
+	fmr_word value = fmr_trampolines[argc](function, words);
+
+	/* Only the bits of the return type are defined. */
+	switch (ret) {
+		case lf_void_t: return 0;
+		case lf_uint8_t: return (uint8_t)value;
+		case lf_uint16_t: return (uint16_t)value;
+		case lf_int8_t: return (int8_t)value;
+		case lf_int16_t: return (int16_t)value;
+		default: return (lf_return_t)value;
+	}
+failure:
+	return lf_error;
+}
@@ -4,8 +4,7 @@
 #include <flipper/types.h>
 #include <flipper/ll.h>
 #include <flipper/message.h>
-
-typedef struct _lf_ll lf_msg_queue;
+#include <flipper/queue.h>
 
 /* Standardizes interaction with a physical hardware bus for the transmission of arbitrary data. */
 struct _lf_endpoint {
@@ -21,6 +20,11 @@ struct _lf_endpoint {
 	int (* destroy)(struct _lf_endpoint *endpoint);
 	/* Tracks endpoint specific context. */
 	void *_ctx;
+	/* Fills in up to 'count' file descriptors that become readable when data arrives, and returns how many there are. NULL if the endpoint can only be polled. */
+	int (* descriptors)(struct _lf_endpoint *endpoint, int *fds, int count);
+	/* Messages waiting to be sent over the endpoint, and messages received over it waiting to be applied. */
+	struct _lf_queue *outgoing;
+	struct _lf_queue *incoming;
 };
 
 enum { _endpoint_configure, _endpoint_ready, _endpoint_push, _endpoint_pull, _endpoint_destroy };
@@ -32,6 +36,7 @@ struct _lf_endpoint *lf_endpoint_create(int (* configure)(struct _lf_endpoint *e
 										int (* destroy)(struct _lf_endpoint *endpoint),
 										size_t ctx_size);
 int lf_endpoint_enqueue(struct _lf_endpoint *endpoint, struct _lf_msg *message);
+int lf_endpoint_deliver(struct _lf_endpoint *endpoint, struct _lf_msg *message);
 bool lf_endpoint_has_data(struct _lf_endpoint *endpoint);
 struct _lf_msg *lf_endpoint_dequeue(struct _lf_endpoint *endpoint);
 void lf_endpoint_poll(struct _lf_endpoint *endpoint);
@@ -8,10 +8,11 @@
 extern const struct _fld_interface {
 	int (* configure)(void);
 	int (* index)(lf_crc_t identifier);
+	int (* table)(lf_crc_t *identifiers, lf_size_t length);
 } fld;
 
 /* Declare the FMR overlay for this module. */
-enum { _fld_configure, _fld_index };
+enum { _fld_configure, _fld_index, _fld_table };
 
 /* Declare the _lf_module structure for this module. */
 extern struct _lf_module _fld;
@@ -20,5 +21,7 @@ extern struct _lf_module _fld;
 int fld_configure(void);
 /* Returns the index of a loaded module. */
 int fld_index(lf_crc_t identifier);
+/* Writes the identifier of each loaded module at its index and returns the number of loaded modules. */
+int fld_table(lf_crc_t *identifiers, lf_size_t length);
 
 #endif
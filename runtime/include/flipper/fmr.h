@@ -7,8 +7,14 @@
 #include <flipper/error.h>
 #include <flipper/ll.h>
 
-/* The size of a single FMR packet expressed in bytes. */
+/* The size of a single FMR packet expressed in bytes. Every device accepts frames up to this size. */
 #define FMR_PACKET_SIZE 64
+/* The size of the largest frame that a device built for this platform accepts. */
+#ifdef ATMEGAU2
+#define FMR_MAX_PACKET_SIZE FMR_PACKET_SIZE
+#else
+#define FMR_MAX_PACKET_SIZE 512
+#endif
 /* The magic number that indicates the start of a packet. */
 #define FMR_MAGIC_NUMBER 0xFE
 
@@ -27,6 +33,8 @@ typedef uint8_t lf_argc;
 
 /* The maximum number of arguments that can be encoded into a packet. */
 #define FMR_MAX_ARGC 16
+/* The argument count of a vector that failed to build. Calls made with it fail, rather than being sent without their arguments. */
+#define FMR_ARGS_INVALID 0xff
 /* Used to hold encoded prameter types within invocation metadata.
    NOTE: This type must be capable of encoding the exact number of bits
 		 given by (FMR_MAX_ARGC * 2).
@@ -62,6 +70,12 @@ enum {
 	lf_max_t = 15
 };
 
+/* The set of types, one bit per type, that an argument can take. */
+#define FMR_ARG_TYPES ((1 << lf_uint8_t) | (1 << lf_uint16_t) | (1 << lf_uint32_t) | (1 << lf_uint64_t) | (1 << lf_int_t) | (1 << lf_ptr_t) | \
+					   (1 << lf_int8_t) | (1 << lf_int16_t) | (1 << lf_int32_t) | (1 << lf_int64_t))
+/* The set of types that a function can return. */
+#define FMR_RET_TYPES (FMR_ARG_TYPES | (1 << lf_void_t))
+
 /* A type used to reference the values in the enum above. */
 typedef uint8_t lf_type;
 
@@ -71,8 +85,8 @@ typedef uint8_t lf_type;
 #define __fmr_count_implicit(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _a, _b, _c, _d, _e, _f, _10, n, ...) n
 #define __fmr_count(...) __fmr_count_implicit(_, ##__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
 
-/* Generates and returns a pointer to an 'fmr_parameters' given a list of variadic arguments. */
-#define lf_args(...) fmr_build((__fmr_count(__VA_ARGS__)/2), ##__VA_ARGS__)
+/* Generates and returns a pointer to a stack allocated 'struct _fmr_args' given a list of variadic arguments. */
+#define lf_args(...) fmr_args(&(struct _fmr_args){ 0 }, (__fmr_count(__VA_ARGS__)/2), ##__VA_ARGS__)
 
 /* ~ Parser macros for variables. */
 
@@ -117,7 +131,17 @@ enum {
 	/* Experimental: Caused a RAM load and launch. */
 	fmr_ram_load_class,
 	/* Signals the occurance an event. */
-	fmr_event_class
+	fmr_event_class,
+	/* Invokes a sequence of functions in standard or user modules. */
+	fmr_batch_class,
+	/* Performs a push whose data is carried within the packet. */
+	fmr_inline_push_class,
+	/* Performs a pull whose data is carried within the result. */
+	fmr_inline_pull_class,
+	/* Reports the failures of the packets that were performed without a reply. */
+	fmr_sync_class,
+	/* Reports the device's configuration and capabilities. */
+	fmr_configuration_class
 };
 
 /* A type used to reference the values in the enum above. */
@@ -133,8 +157,17 @@ struct LF_PACKED _fmr_header {
 	uint16_t length;
 	/* The packet's type. */
 	fmr_class type;
+	/* The sequence number used to match the packet with its result. */
+	uint8_t sequence;
+	/* Flags that modify how the packet is handled. */
+	uint8_t flags;
 };
 
+/* The device does not send a result for the packet. Failures are counted and reported by the next sync packet. */
+#define FMR_FLAG_NO_REPLY (1 << 0)
+/* The packet carries no checksum because the device's transport already detects corruption. */
+#define FMR_FLAG_UNCHECKED (1 << 1)
+
 /* Standardizes the notion of an argument. */
 struct _lf_arg {
 	/* The type of the argument. */
@@ -143,12 +176,26 @@ struct _lf_arg {
 	lf_arg value;
 };
 
-/* Generic packet data type that can be passed around by packet parsing equipment. */
+/* A fixed capacity vector of arguments, encoded exactly as they will appear in a packet. */
+struct _fmr_args {
+	/* The types of the encoded arguments. */
+	lf_types types;
+	/* The number of encoded arguments. */
+	lf_argc argc;
+	/* The number of bytes occupied by the encoded argument values. */
+	uint8_t size;
+	/* The encoded values of the arguments. */
+	uint8_t values[FMR_MAX_ARGC * sizeof(lf_arg)];
+};
+
+/* Generic packet data type that can be passed around by packet parsing equipment.
+   NOTE: Only the first 'header.length' bytes of a packet are sent, so the receiver reads the header and then the remainder.
+*/
 struct LF_PACKED _fmr_packet {
 	/* The header shared by all packet classes. */
 	struct _fmr_header header;
 	/* A generic payload that is designed to be casted against the class specific data structures. */
-	uint8_t payload[(FMR_PACKET_SIZE - sizeof(struct _fmr_header))];
+	uint8_t payload[(FMR_MAX_PACKET_SIZE - sizeof(struct _fmr_header))];
 };
 
 /* Procedure call metadata carried by a packet. */
@@ -185,15 +232,54 @@ struct LF_PACKED _fmr_push_pull_packet {
 	struct _fmr_invocation call;
 };
 
+/* The largest amount of data that a push or pull carries inline instead of through a separate transfer. */
+#define FMR_INLINE_SIZE 48
+
+/* The maximum number of invocations that can be carried by a batch packet. */
+#define FMR_MAX_BATCH 16
+
+/* A single invocation within a batch packet. */
+struct LF_PACKED _fmr_batch_entry {
+	/* The class of the invocation, either 'fmr_standard_invocation_class' or 'fmr_user_invocation_class'. */
+	fmr_class type;
+	/* The procedure call information of the invocation. */
+	struct _fmr_invocation call;
+};
+
+/* Contains a sequence of invocations that are to be performed in order. */
+struct LF_PACKED _fmr_batch_packet {
+	/* The packet header programmed with 'fmr_batch_class'. */
+	struct _fmr_header header;
+	/* The number of invocations carried by the packet. */
+	uint8_t count;
+	/* The invocations, packed back to back. */
+	uint8_t entries[];
+};
+
 /* A generic datastructure that is sent back following any message runtime transaction. */
 struct LF_PACKED _fmr_result {
 	/* The return value of the function called (if any). */
 	lf_return_t value;
 	/* The error code generated on the device. */
 	lf_error_t error;
+	/* The sequence number of the packet that produced this result. */
+	uint8_t sequence;
 	/* NOTE: Add bitfield indicating the need to poll for updates. */
 };
 
+/* The result of a packet, followed by the data of an inline pull or the device's configuration. Sent back to the host as a single transfer. */
+struct LF_PACKED _fmr_reply {
+	/* The result of the packet. */
+	struct _fmr_result result;
+	/* The data of an inline pull. */
+	uint8_t data[FMR_INLINE_SIZE];
+};
+
+/* The number of packets performed without a reply that have failed since the last sync. */
+extern lf_return_t fmr_deferred_count;
+/* The error code of the most recent of those failures. */
+extern lf_error_t fmr_deferred_error;
+
 /* A reference to the lf_modules array. */
 extern const void *const lf_modules[];
 
@@ -202,25 +288,44 @@ extern const void *const lf_modules[];
 /* Appends an argument to an fmr_parameters. */
 int lf_append(struct _lf_ll *list, lf_type type, lf_arg value);
 /* Generates the appropriate data structure needed for the remote procedure call of 'funtion' in 'module'. */
-int lf_create_call(lf_module module, lf_function function, lf_type ret, struct _lf_ll *args, struct _fmr_header *header, struct _fmr_invocation *call);
+int lf_create_call(lf_module module, lf_function function, lf_type ret, struct _fmr_args *args, struct _fmr_header *header, struct _fmr_invocation *call);
 /* Creates a struct _lf_arg * type. */
 struct _lf_arg *lf_arg_create(lf_type type, lf_arg value);
-
-/* Builds an fmr_parameters from a set of variadic arguments provided by the fmr_parameters macro. */
+/* Releases a struct _lf_arg * type. */
+void lf_arg_release(struct _lf_arg *arg);
+
+/* Encodes an argument and appends it to an argument vector. */
+int fmr_append(struct _fmr_args *args, lf_type type, lf_arg value);
+/* Builds an argument vector from a set of variadic arguments provided by the lf_args macro. If an argument cannot be encoded, the vector is marked invalid. */
+struct _fmr_args *fmr_args(struct _fmr_args *args, int argc, ...);
+/* Encodes the arguments held by a list into an argument vector. Releases the list. If an argument cannot be encoded, the vector is marked invalid. */
+int fmr_args_from_list(struct _fmr_args *args, struct _lf_ll *list);
+
+/* Calculates the number of bytes occupied by the encoded parameters of a call. */
+lf_size_t fmr_parameters_size(struct _fmr_invocation *call);
+/* Builds an argument list from a set of variadic arguments. Retained for language bindings that construct lists. */
 struct _lf_ll *fmr_build(int argc, ...);
 /* Executes a standard module. */
 lf_return_t fmr_execute(lf_module module, lf_function function, lf_type ret, lf_argc argc, lf_types argt, void *arguments);
-/* Executes an fmr_packet and stores the result of the operation in the result buffer provided. */
-int fmr_perform(struct _fmr_packet *packet, struct _fmr_result *result);
+/* Executes an fmr_packet and stores the result of the operation in the reply provided. Returns the number of bytes of the reply to send. */
+lf_size_t fmr_perform(struct _fmr_packet *packet, struct _fmr_reply *reply);
+/* Executes each invocation in a batch packet, storing their results in the buffer provided. Returns the number performed. */
+int fmr_execute_batch(struct _fmr_batch_packet *packet, struct _fmr_result *results);
 
 /* Helper function for lf_push. */
 extern lf_return_t fmr_push(struct _fmr_push_pull_packet *packet);
 /* Helper function for lf_pull. */
 extern lf_return_t fmr_pull(struct _fmr_push_pull_packet *packet);
+/* Performs a push whose data is carried within the packet. */
+lf_return_t fmr_push_inline(struct _fmr_push_pull_packet *packet);
+/* Performs a pull whose data is stored in the destination provided. */
+lf_return_t fmr_pull_inline(struct _fmr_push_pull_packet *packet, void *destination);
+/* Helper function for lf_batch_commit. */
+extern lf_return_t fmr_batch(struct _fmr_batch_packet *packet);
 
 /* ~ Functions with platform specific implementation. ~ */
 
 /* Unpacks the argument buffer into the CPU following the native architecture's calling convention and jumps to the given function pointer. */
-extern lf_return_t fmr_call(lf_return_t (* function)(void), lf_type ret, uint8_t argc, uint16_t argt, void *argv);
+extern lf_return_t fmr_call(lf_return_t (* function)(void), lf_type ret, uint8_t argc, lf_types argt, void *argv);
 
 #endif
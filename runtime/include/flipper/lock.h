@@ -0,0 +1,28 @@
+/* lock.h - A lock that a thread may take more than once, whose uncontended acquire and release are each a single atomic operation. */
+
+#ifndef __lf_lock_h__
+#define __lf_lock_h__
+
+#include <flipper/types.h>
+
+struct _lf_lock {
+	/* 0 if the lock is free, 1 if it is held, and 2 if it is held and another thread may be waiting for it. */
+	uint32_t state;
+	/* The thread that holds the lock, or 0, and how many times that thread has taken it. */
+	uint32_t owner;
+	uint32_t depth;
+};
+
+/* Waits until the lock is free, then takes it. Returns at once if the calling thread already holds it. */
+void lf_lock(struct _lf_lock *lock);
+/* Undoes one call to lf_lock, freeing the lock once every call has been undone. */
+void lf_unlock(struct _lf_lock *lock);
+/* Returns a number that is unique to the calling thread and never 0. */
+uint32_t lf_thread_id(void);
+
+/* Sleeps while the word still holds 'value'. Platforms without a way to sleep on a word return at once. */
+void lf_lock_wait(uint32_t *word, uint32_t value);
+/* Wakes a thread sleeping on the word. */
+void lf_lock_wake(uint32_t *word);
+
+#endif
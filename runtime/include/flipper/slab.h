@@ -0,0 +1,52 @@
+/* slab.h - Fixed size pools of objects of a single type, that any thread can take from and return to in constant time. */
+
+#ifndef __lf_slab_h__
+#define __lf_slab_h__
+
+#include <flipper/types.h>
+
+/* The most objects a slab can hold, as the index of an object shares a word with the tag that guards the free list. */
+#define LF_SLAB_MAX_COUNT 0xffff
+
+struct _lf_slab {
+	/* The type of the objects, for reporting. */
+	const char *name;
+	/* The size of each object, and the number of objects. */
+	uint32_t size;
+	uint32_t count;
+	/* The memory that holds the objects, and for each free object, one more than the index of the next free object. */
+	uint8_t *objects;
+	uint32_t *links;
+	/* The free list. One more than the index of its first object, or 0 if it is empty, in the low half. The upper half is a tag that changes whenever the list does. */
+	uint32_t top;
+	/* The number of objects that have ever been taken from the slab. The free list is used first, so this is also the most that have been in use at once. */
+	uint32_t fresh;
+	/* Whether objects are taken from the heap once all of the slab's are in use, rather than failing. */
+	bool overflow;
+	/* The number of allocations that found every one of the slab's objects in use. */
+	uint32_t exhausted;
+};
+
+/* Defines a slab of 'count' objects of the given type, and the memory that backs it. */
+#define LF_SLAB_DEFINE(_slab, _type, _count) \
+	_type _slab##_objects[_count]; \
+	uint32_t _slab##_links[_count]; \
+	struct _lf_slab _slab = { #_type, sizeof(_type), (_count), (uint8_t *)_slab##_objects, _slab##_links, 0, 0, LF_SLAB_OVERFLOW, 0 }
+
+/* The slabs that the runtime's messages, events, observers, arguments and list nodes are taken from. */
+extern struct _lf_slab lf_msg_slab;
+extern struct _lf_slab lf_event_slab;
+extern struct _lf_slab lf_observer_slab;
+extern struct _lf_slab lf_arg_slab;
+extern struct _lf_slab lf_ll_slab;
+
+/* Takes an object from the slab. Returns NULL if the slab is exhausted and may not overflow onto the heap. */
+void *lf_slab_alloc(struct _lf_slab *slab);
+/* Returns an object to the slab it was taken from. Objects that overflowed onto the heap are freed. */
+void lf_slab_free(struct _lf_slab *slab, void *object);
+/* Returns true if the object is one of the slab's own, rather than one taken from the heap. */
+bool lf_slab_owns(struct _lf_slab *slab, void *object);
+/* Prints how much of the slab is in use, the most that has been, and how often it has run out. The number in use is only a snapshot. */
+void lf_slab_report(struct _lf_slab *slab);
+
+#endif
@@ -31,6 +31,12 @@
 #define LF_PACKED __attribute__((__packed__))
 /* Weak attribute. */
 #define LF_WEAK __attribute__((weak))
+/* Gives each thread its own copy of a variable. Targets without threads share a single copy. */
+#ifdef POSIX
+#define LF_THREAD_LOCAL __thread
+#else
+#define LF_THREAD_LOCAL
+#endif
 
 /* Used to contain the result of checksumming operations. */
 typedef uint16_t lf_crc_t;
@@ -0,0 +1,48 @@
+/* vector.h - A growable array of items, for lists that are walked far more often than they are changed. */
+
+#ifndef __lf_vector_h__
+#define __lf_vector_h__
+
+#include <flipper/types.h>
+#include <flipper/ll.h>
+
+/* The number of items a vector makes room for the first time it grows. */
+#define LF_VECTOR_INITIAL_CAPACITY 4
+
+struct _lf_vector {
+	/* The items, stored contiguously in the order they were appended. */
+	void **items;
+	/* The number of items in the vector, and the number it can hold before it has to grow. */
+	uint32_t count;
+	uint32_t capacity;
+	/* A deconstructor for the items, if any. Called on each item as it is removed. */
+	int (* deconstructor)(void *item);
+};
+
+/* Initializes an empty vector whose items are released with the given deconstructor. */
+#define LF_VECTOR(_deconstructor) { NULL, 0, 0, (int (*)(void *))(_deconstructor) }
+
+/* Prepares an empty vector. Vectors that are zeroed or initialized with LF_VECTOR need not be. */
+void lf_vector_init(struct _lf_vector *vector, void *deconstructor);
+/* Appends the item to the vector, growing it if necessary. */
+int lf_vector_append(struct _lf_vector *vector, void *item);
+/* Returns true if the item is in the vector. */
+bool lf_vector_contains(struct _lf_vector *vector, void *item);
+/* Removes matching items from the vector, keeping the others in order. */
+void lf_vector_remove(struct _lf_vector *vector, void *item);
+/* Applys a fast enumeration function to each item in the vector. */
+void lf_vector_apply_func(struct _lf_vector *vector, lf_ll_applier_func func, void *_ctx);
+/* Releases all of the items in the vector and the memory that held them. */
+int lf_vector_release(struct _lf_vector *vector);
+
+/* Returns the number of items in the vector. */
+static inline uint32_t lf_vector_count(struct _lf_vector *vector) {
+	return vector->count;
+}
+
+/* Retrieves an item from the vector at the given index, or NULL if there is no such item. */
+static inline void *lf_vector_item(struct _lf_vector *vector, uint32_t index) {
+	return (index < vector->count) ? vector->items[index] : NULL;
+}
+
+#endif
@@ -14,37 +14,70 @@ struct _lf_endpoint *lf_endpoint_create(int (* configure)(struct _lf_endpoint *e
 	endpoint->ready = ready;
 	endpoint->push = push;
 	endpoint->pull = pull;
-	endpoint->destroy = destroy;
 	endpoint->_ctx = calloc(1, ctx_size);
 	lf_assert(endpoint->_ctx, failure, E_MALLOC, "Failed to allocate the memory needed to create an endpoint context.");
+	endpoint->outgoing = lf_queue_create(LF_ENDPOINT_QUEUE_SIZE);
+	lf_assert(endpoint->outgoing, failure, E_MALLOC, "Failed to allocate the outgoing message queue of a new endpoint.");
+	endpoint->incoming = lf_queue_create(LF_ENDPOINT_QUEUE_SIZE);
+	lf_assert(endpoint->incoming, failure, E_MALLOC, "Failed to allocate the incoming message queue of a new endpoint.");
+	/* Set last, so that a context that was never set up is not torn down. */
+	endpoint->destroy = destroy;
 	return endpoint;
 failure:
+	lf_endpoint_release(endpoint);
 	return NULL;
 }
 
-/* Enqueues a message for sending over the endpoint. */
+/* Enqueues a message for sending over the endpoint. May be called from any thread. */
 int lf_endpoint_enqueue(struct _lf_endpoint *endpoint, struct _lf_msg *message) {
+	lf_assert(endpoint && message, failure, E_NULL, "NULL");
+	lf_assert(lf_queue_push(endpoint->outgoing, message), failure, E_OVERFLOW, "The outgoing message queue of the endpoint is full.");
+	/* Woken only once the push is complete, as the event handler would not see the message before then and could sleep past it. */
+	lf_reactor_wake();
+	return lf_success;
+failure:
 	return lf_error;
 }
 
+/* Hands a message received over the endpoint to the thread that handles its events. May be called from any thread. */
+int lf_endpoint_deliver(struct _lf_endpoint *endpoint, struct _lf_msg *message) {
+	lf_assert(endpoint && message, failure, E_NULL, "NULL");
+	lf_assert(lf_queue_push(endpoint->incoming, message), failure, E_OVERFLOW, "The incoming message queue of the endpoint is full.");
+	lf_reactor_wake();
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+/* Returns whether messages are waiting to be applied. A message whose delivery is still under way may not be seen, but the delivery wakes the event handler once it is done. */
 bool lf_endpoint_has_data(struct _lf_endpoint *endpoint) {
-	return NULL;
+	return endpoint && !lf_queue_empty(endpoint->incoming);
 }
 
-/* Dequeues the next message to be sent. */
+/* Dequeues the next message received over the endpoint. */
 struct _lf_msg *lf_endpoint_dequeue(struct _lf_endpoint *endpoint) {
-	return NULL;
+	return (endpoint) ? lf_queue_pop(endpoint->incoming) : NULL;
 }
 
-/* Checks to see if any messages are available over the endpoint, and loads them into the incoming queue if there are. This function should never block! */
+/* Sends the messages that have been enqueued on the endpoint. Only the thread that handles the endpoint's events should call this. */
 void lf_endpoint_poll(struct _lf_endpoint *endpoint) {
-	/* Checks if there is any data available over this endpoint. If there is, it is loaded into the message processing queue. */
-
+	if (!endpoint) return;
+	struct _lf_msg *message;
+	while ((message = lf_queue_pop(endpoint->outgoing))) {
+		lf_msg_send(message, endpoint);
+		lf_msg_release(message);
+	}
 }
 
 int lf_endpoint_release(struct _lf_endpoint *endpoint) {
 	if (endpoint) {
 		if (endpoint->destroy) endpoint->destroy(endpoint);
+		/* Messages that were never sent or applied go back to the pool. */
+		struct _lf_msg *message;
+		while (endpoint->outgoing && (message = lf_queue_pop(endpoint->outgoing))) lf_msg_release(message);
+		while (endpoint->incoming && (message = lf_queue_pop(endpoint->incoming))) lf_msg_release(message);
+		lf_queue_release(endpoint->outgoing);
+		lf_queue_release(endpoint->incoming);
 		free(endpoint->_ctx);
 		free(endpoint);
 	}
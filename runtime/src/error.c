@@ -4,12 +4,13 @@
 
 /* Expose the error message strings. */
 char *lf_error_messages[] = { LF_ERROR_MESSAGE_STRINGS };
-char last_error[256];
-lf_error_t error_code = E_OK;
+/* Each thread observes only the errors that it raised. */
+LF_THREAD_LOCAL char last_error[256];
+LF_THREAD_LOCAL lf_error_t error_code = E_OK;
 #ifdef __no_err_str__
-uint8_t errors_cause_side_effects = 0;
+LF_THREAD_LOCAL uint8_t errors_cause_side_effects = 0;
 #else
-uint8_t errors_cause_side_effects = 1;
+LF_THREAD_LOCAL uint8_t errors_cause_side_effects = 1;
 #endif
 
 int lf_error_configure(void) {
@@ -1,28 +1,124 @@
 #include <flipper.h>
+#include <flipper/slab.h>
+
+LF_SLAB_DEFINE(lf_event_slab, struct _lf_event, LF_EVENT_POOL_SIZE);
 
 struct _lf_event *lf_event_create(lf_event_id _id, lf_event_handler_func handler, void *_ctx) {
-	struct _lf_event *event = malloc(sizeof(struct _lf_event));
-	lf_assert(event, failure, E_NULL, "NULL");
+	struct _lf_event *event = lf_slab_alloc(&lf_event_slab);
+	lf_assert(event, failure, E_MALLOC, "Failed to allocate memory for a new event.");
 	memset(event, 0, sizeof(struct _lf_event));
 	event -> id = _id;
 	event -> handler = handler;
 	event -> ctx = _ctx;
+	lf_vector_init(&(event -> observers), lf_observer_release);
 	return event;
 failure:
 	return NULL;
 }
 
-/* Returns an unused event id. */
+/* Spreads identifiers that differ only in their high bits across the slots of the table. */
+uint32_t lf_event_hash(lf_event_id id) {
+	id ^= id >> 16;
+	id *= 0x45d9f3b;
+	id ^= id >> 16;
+	return id;
+}
+
+/* Returns the slot holding the event with the given identifier, or the empty slot where it would go. The table must have a free slot. */
+struct _lf_event **lf_event_slot(struct _lf_event_table *table, lf_event_id id) {
+	uint32_t mask = table -> size - 1;
+	for (uint32_t i = lf_event_hash(id) & mask; ; i = (i + 1) & mask) {
+		struct _lf_event **slot = &table -> slots[i];
+		if (!*slot || (*slot) -> id == id) return slot;
+	}
+}
+
+/* Doubles the number of slots, moving each event to its slot in the larger table. */
+int lf_event_table_grow(struct _lf_event_table *table) {
+	uint32_t size = (table -> size) ? table -> size * 2 : LF_EVENT_TABLE_SIZE;
+	struct _lf_event **slots = calloc(size, sizeof(struct _lf_event *));
+	lf_assert(slots, failure, E_MALLOC, "Failed to allocate memory to grow the event table.");
+	struct _lf_event **previous = table -> slots;
+	uint32_t previous_size = table -> size;
+	table -> slots = slots;
+	table -> size = size;
+	for (uint32_t i = 0; i < previous_size; i ++) {
+		if (previous[i]) *lf_event_slot(table, previous[i] -> id) = previous[i];
+	}
+	free(previous);
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_event_table_insert(struct _lf_event_table *table, struct _lf_event *event) {
+	/* Keep the table at most three quarters full, so that searches stay short and always find an empty slot. */
+	if ((table -> count + 1) * 4 > table -> size * 3) {
+		int _e = lf_event_table_grow(table);
+		lf_assert(_e == lf_success, failure, E_MALLOC, "Failed to make room for event %u.", event -> id);
+	}
+	struct _lf_event **slot = lf_event_slot(table, event -> id);
+	lf_assert(!*slot, failure, E_CONFIGURATION, "An event with the identifier %u is already registered.", event -> id);
+	*slot = event;
+	table -> count ++;
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+struct _lf_event *lf_event_table_find(struct _lf_event_table *table, lf_event_id id) {
+	if (!table -> size) return NULL;
+	return *lf_event_slot(table, id);
+}
+
+void lf_event_table_remove(struct _lf_event_table *table, struct _lf_event *event) {
+	if (!table -> size) return;
+	struct _lf_event **slot = lf_event_slot(table, event -> id);
+	if (*slot != event) return;
+	uint32_t mask = table -> size - 1;
+	uint32_t hole = slot - table -> slots;
+	/* Move back the events after the hole that could not be placed before it, so that no search stops at the hole short of them. */
+	for (uint32_t i = (hole + 1) & mask; table -> slots[i]; i = (i + 1) & mask) {
+		uint32_t home = lf_event_hash(table -> slots[i] -> id) & mask;
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			table -> slots[hole] = table -> slots[i];
+			hole = i;
+		}
+	}
+	table -> slots[hole] = NULL;
+	table -> count --;
+}
+
+void lf_event_table_release(struct _lf_event_table *table) {
+	lf_lock(&table -> lock);
+	for (uint32_t i = 0; i < table -> size; i ++) {
+		if (table -> slots[i]) lf_event_release(table -> slots[i]);
+	}
+	free(table -> slots);
+	table -> slots = NULL;
+	table -> size = table -> count = 0;
+	lf_unlock(&table -> lock);
+}
+
+/* Returns an event id that no registered event is using. */
 lf_event_id lf_event_generate_unique_id(void) {
-	return rand();
+	struct _lf_event_table *table = &lf_get_event_list();
+	lf_lock(&table -> lock);
+	/* Identifiers are handed out in order, so they only repeat after all of them have been used. 0 is never used, as it means that there is no event. */
+	lf_event_id id;
+	do {
+		id = ++ table -> last;
+	} while (!id || lf_event_table_find(table, id));
+	lf_unlock(&table -> lock);
+	return id;
 }
 
-/* Tears down an event and its observers, removing it from the event system. */
+/* Tears down an event and its observers. Events that are registered must be released through lf_event_unregister. */
 int lf_event_release(lf_event *event) {
 	lf_assert(event, failure, E_NULL, "NULL");
 	/* Tear down all of the observers registered to this event. */
-	lf_ll_release(&(event -> observers));
-	free(event);
+	lf_vector_release(&(event -> observers));
+	lf_slab_free(&lf_event_slab, event);
 	return lf_success;
 failure:
 	return lf_error;
@@ -32,14 +128,37 @@ failure:
 lf_event *lf_event_register(lf_event_id id, lf_event_handler_func handler, void *ctx) {
 	struct _lf_event *event = lf_event_create(id, handler, ctx);
 	lf_assert(event, failure, E_NULL, "NULL");
-	lf_ll_append(&lf_get_event_list(), event, lf_event_release);
+	struct _lf_event_table *table = &lf_get_event_list();
+	lf_lock(&table -> lock);
+	int _e = lf_event_table_insert(table, event);
+	lf_unlock(&table -> lock);
+	lf_assert(_e == lf_success, release, E_CONFIGURATION, "Failed to register event %u.", id);
 	return event;
+release:
+	lf_event_release(event);
 failure:
 	return NULL;
 }
 
+/* Removes an event from the event system and releases it. */
+int lf_event_unregister(lf_event *event) {
+	lf_assert(event, failure, E_NULL, "NULL");
+	struct _lf_event_table *table = &lf_get_event_list();
+	lf_lock(&table -> lock);
+	lf_event_table_remove(table, event);
+	lf_unlock(&table -> lock);
+	return lf_event_release(event);
+failure:
+	return lf_error;
+}
+
+/* Returns the registered event with the given identifier, or NULL if there is none. */
 struct _lf_event *lf_event_for_id(lf_event_id id) {
-	return NULL;
+	struct _lf_event_table *table = &lf_get_event_list();
+	lf_lock(&table -> lock);
+	struct _lf_event *event = lf_event_table_find(table, id);
+	lf_unlock(&table -> lock);
+	return event;
 }
 
 /* Causes a local event to be triggered when events of the same identifier are triggered on the device. */
@@ -57,7 +176,7 @@ failure:
 /* Triggers an event causing its observers to be notified. */
 int lf_event_trigger(lf_event *event) {
 	/* Trigger all of the event's observers. */
-	lf_ll_apply_func(event -> observers, lf_observer_notify, NULL);
+	lf_vector_apply_func(&(event -> observers), lf_observer_notify, NULL);
 	/* If there is a callback, call it. */
 	if (event -> handler) {
 		event -> handler(event);
@@ -69,24 +188,54 @@ int lf_event_trigger(lf_event *event) {
 void lf_event_handler(const void *_device, void *_other) {
 	struct _lf_device *device = (struct _lf_device *)_device;
 	lf_assert(device, failure, E_NULL, "NULL");
+	/* Keep the endpoint to ourselves while invocations on other threads may be using it. */
+	lf_lock(&device -> lock);
+	/* Send anything that was queued for the device since it was last handled. */
+	lf_endpoint_poll(device -> endpoint);
+	/* Take everything that has arrived over an endpoint that is waited on, so that the wait does not wake again for the same data. */
+	struct _lf_endpoint *endpoint = device -> endpoint;
+	while (endpoint -> descriptors && endpoint -> ready && endpoint -> ready(endpoint)) {
+		/* Whole frames are pulled, as a message is larger than a result and must not be cut short. */
+		struct _fmr_packet frame;
+		memset(&frame, 0, sizeof(struct _fmr_header));
+		if (endpoint -> pull(endpoint, &frame, sizeof(frame)) != lf_success) break;
+		if (lf_msg_framed(&frame)) {
+			/* Messages are queued and applied below, along with any delivered by other threads. */
+			lf_msg_receive(endpoint, &frame);
+		} else if (device -> outstanding) {
+			/* The results of invocations sent without waiting are filed for whoever awaits them. */
+			struct _fmr_result result;
+			memcpy(&result, &frame, sizeof(struct _fmr_result));
+			lf_debug_result(&result);
+			lf_complete(device, &result);
+		}
+		/* Anything else was not expected from the device, and is dropped. */
+	}
 	/* Handle all of the messages available over the device's endpoint. */
 	while (lf_endpoint_has_data(device -> endpoint)) {
 		/* Dequeue a message from the endpoint's incoming message queue. */
 		struct _lf_msg *msg = lf_endpoint_dequeue(device -> endpoint);
-		lf_assert(msg, failure, E_NULL, "NULL");
+		lf_assert(msg, release, E_NULL, "NULL");
 		/* Apply the message to the world. */
 		lf_msg_apply(msg);
+		lf_msg_release(msg);
 	}
+release:
+	lf_unlock(&device -> lock);
 failure:
 	return;
 }
 
-void lf_handle_events(void) {
+/* Platforms whose 'lf_handle_events' sleeps replace this to wake it, so that messages queued from other threads are handled. */
+LF_WEAK void lf_reactor_wake(void) {
+
+}
+
+/* Platforms that can wait on their endpoints replace this with something that sleeps until there is data. */
+LF_WEAK void lf_handle_events(void) {
 	for (;;) {
 		/* Handle events across all attached devices. */
-		if (lf_attached_devices) {
-			lf_ll_apply_func(lf_attached_devices, lf_event_handler, NULL);
-		}
+		lf_vector_apply_func(&lf_attached_devices, lf_event_handler, NULL);
 		// usleep(10000);
 		/* Avoid tail-call optimization. */
 		__asm__ __volatile__ ("");
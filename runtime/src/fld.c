@@ -7,7 +7,8 @@ LF_MODULE(_fld, "fld", "Loads modules on the target device.", NULL, NULL);
 /* Define the virtual interface for this module. */
 const struct _fld_interface fld = {
 	fld_configure,
-	fld_index
+	fld_index,
+	fld_table
 };
 
 LF_WEAK int fld_configure(void) {
@@ -18,4 +19,8 @@ LF_WEAK int fld_index(lf_crc_t identifier) {
 	return lf_invoke(&_fld, _fld_index, lf_int_t, lf_args(lf_infer(identifier)));
 }
 
+LF_WEAK int fld_table(lf_crc_t *identifiers, lf_size_t length) {
+	return lf_pull(&_fld, _fld_table, identifiers, length, NULL);
+}
+
 #endif
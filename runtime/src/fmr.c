@@ -1,7 +1,11 @@
 #include <flipper.h>
+#include <flipper/slab.h>
+
+/* Arguments are taken from a slab, as a list of them is built for every call made through the bindings. */
+LF_SLAB_DEFINE(lf_arg_slab, struct _lf_arg, LF_ARG_POOL_SIZE);
 
 struct _lf_arg *lf_arg_create(lf_type type, lf_arg value) {
-	struct _lf_arg *arg = malloc(sizeof(struct _lf_arg));
+	struct _lf_arg *arg = lf_slab_alloc(&lf_arg_slab);
 	lf_assert(arg, failure, E_MALLOC, "Failed to allocate new lf_arg.");
 	arg->type = type;
 	arg->value = value;
@@ -11,7 +15,7 @@ failure:
 }
 
 void lf_arg_release(struct _lf_arg *arg) {
-	if (arg) free(arg);
+	lf_slab_free(&lf_arg_slab, arg);
 }
 
 struct _lf_ll *fmr_build(int argc, ...) {
@@ -39,37 +43,82 @@ failure:
 	return NULL;
 }
 
-int lf_create_call(lf_module module, lf_function function, lf_type ret, struct _lf_ll *args, struct _fmr_header *header, struct _fmr_invocation *call) {
+int fmr_append(struct _fmr_args *args, lf_type type, lf_arg value) {
+	lf_assert(args, failure, E_NULL, "NULL argument vector passed to '%s'.", __PRETTY_FUNCTION__);
+	lf_assert(type <= lf_max_t, failure, E_TYPE, "An invalid type was provided while appending the parameter '%llx' with type '%x' to the argument vector.", (unsigned long long)value, type);
+	/* Each type occupies four bits of the type field. */
+	lf_assert(args->argc < FMR_MAX_ARGC && args->argc < (sizeof(lf_types) * 2), failure, E_OVERFLOW, "Too many arguments were provided when building a call.");
+	/* Encode the argument's type. */
+	args->types |= (lf_types)(type & lf_max_t) << (args->argc * 4);
+	/* Copy the argument into the value segment. */
+	uint8_t size = lf_sizeof(type);
+	memcpy(&args->values[args->size], &value, size);
+	args->size += size;
+	args->argc ++;
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+struct _fmr_args *fmr_args(struct _fmr_args *args, int argc, ...) {
+	/* Construct a va_list to access variadic arguments. */
+	va_list argv;
+	/* Initialize the va_list that we created above. */
+	va_start(argv, argc);
+	/* Walk the variadic argument list, encoding each argument into the vector. */
+	while (argc --) {
+		/* Unstage the value of the argument from the variadic argument list. */
+		int type = va_arg(argv, int);
+		lf_arg value = va_arg(argv, lf_arg);
+		int _e = fmr_append(args, type, value);
+		lf_assert(_e == lf_success, failure, E_OVERFLOW, "Failed to append argument to call.");
+	}
+	va_end(argv);
+	return args;
+failure:
+	va_end(argv);
+	/* Returning NULL would look like a call without arguments. */
+	args->argc = FMR_ARGS_INVALID;
+	return args;
+}
+
+int fmr_args_from_list(struct _fmr_args *args, struct _lf_ll *list) {
+	lf_assert(args, failure, E_NULL, "NULL argument vector passed to '%s'.", __PRETTY_FUNCTION__);
+	memset(args, 0, sizeof(struct _fmr_args));
+	for (struct _lf_ll *node = list; node; node = node->next) {
+		struct _lf_arg *arg = node->item;
+		lf_assert(arg, failure, E_NULL, "Invalid argument supplied to '%s'.", __PRETTY_FUNCTION__);
+		int _e = fmr_append(args, arg->type, arg->value);
+		lf_assert(_e == lf_success, failure, E_OVERFLOW, "Failed to append argument to call.");
+	}
+	lf_ll_release(&list);
+	return lf_success;
+failure:
+	lf_ll_release(&list);
+	if (args) args->argc = FMR_ARGS_INVALID;
+	return lf_error;
+}
+
+int lf_create_call(lf_module module, lf_function function, lf_type ret, struct _fmr_args *args, struct _fmr_header *header, struct _fmr_invocation *call) {
 	lf_assert(header, failure, E_NULL, "NULL header passed to '%s'.", __PRETTY_FUNCTION__);
 	lf_assert(call, failure, E_NULL, "NULL call passed to '%s'.", __PRETTY_FUNCTION__);
 	/* Store the target module, function, and argument count in the packet. */
-	size_t argc = lf_ll_count(args);
 	call->index = module;
 	call->function = function;
 	call->ret = ret;
-	call->argc = argc;
-	/* Calculate the offset into the packet at which the arguments will be loaded. */
-	uint8_t *offset = (uint8_t *)&(call->parameters);
-	/* Load arguments into the packet, encoding the type of each. */
-	for (size_t i = 0; i < argc; i ++) {
-		/* Pop the argument from the argument list. */
-		struct _lf_arg *arg = lf_ll_item(args, i);
-		lf_assert(arg, failure, E_NULL, "Invalid argument supplied to '%s'.", __PRETTY_FUNCTION__);
-		/* Encode the argument's type. */
-		call->types |= (arg->type & lf_max_t) << (i * 4);
-		/* Calculate the size of the argument. */
-		uint8_t size = lf_sizeof(arg->type);
-		/* Copy the argument into the parameter segment. */
-		memcpy(offset, &(arg->value), size);
-		/* Increment the offset appropriately. */
-		offset += size;
-		/* Increment the size of the packet. */
-		header->length += size;
-	}
-	lf_ll_release(&args);
+	call->argc = 0;
+	call->types = 0;
+	if (!args) return lf_success;
+	lf_assert(args->argc != FMR_ARGS_INVALID, failure, E_OVERFLOW, "The arguments of the call could not be encoded.");
+	/* Ensure that the encoded arguments fit within the packet. */
+	lf_assert(header->length + args->size <= sizeof(struct _fmr_packet), failure, E_FMR_OVERFLOW, "The arguments of the call do not fit within a packet.");
+	call->argc = args->argc;
+	call->types = args->types;
+	/* The arguments are already encoded, so they can be copied directly into the parameter segment. */
+	memcpy(call->parameters, args->values, args->size);
+	header->length += args->size;
 	return lf_success;
 failure:
-	lf_ll_release(&args);
 	return lf_error;
 }
 
@@ -86,6 +135,18 @@ failure:
 	return lf_error;
 }
 
+/* Calculates the number of bytes occupied by the encoded parameters of a call. */
+lf_size_t fmr_parameters_size(struct _fmr_invocation *call) {
+	lf_size_t size = 0;
+	lf_types types = call->types;
+	for (lf_argc i = 0; i < call->argc; i ++) {
+		lf_type type = types & lf_max_t;
+		size += lf_sizeof(type);
+		types >>= 4;
+	}
+	return size;
+}
+
 /* ~ Message runtime subclass handlers. ~ */
 
 LF_WEAK lf_return_t fmr_perform_user_invocation(struct _fmr_invocation *invocation, struct _fmr_result *result) {
@@ -93,15 +154,81 @@ LF_WEAK lf_return_t fmr_perform_user_invocation(struct _fmr_invocation *invocati
 	return lf_error;
 }
 
-int fmr_perform(struct _fmr_packet *packet, struct _fmr_result *result) {
+int fmr_execute_batch(struct _fmr_batch_packet *packet, struct _fmr_result *results) {
+	lf_assert(packet->count <= FMR_MAX_BATCH, failure, E_OVERFLOW, "Too many invocations (%i) were provided in a batch.", packet->count);
+	uint8_t *offset = packet->entries;
+	uint8_t *end = (uint8_t *)packet + packet->header.length;
+	int i;
+	for (i = 0; i < packet->count; i ++) {
+		struct _fmr_batch_entry *entry = (struct _fmr_batch_entry *)offset;
+		/* Ensure that the entry and its parameters lie within the packet. */
+		lf_assert(entry->call.parameters <= end, failure, E_FMR_OVERFLOW, "Batch entry %i overruns the packet.", i);
+		offset = entry->call.parameters + fmr_parameters_size(&entry->call);
+		lf_assert(offset <= end, failure, E_FMR_OVERFLOW, "Batch entry %i overruns the packet.", i);
+		/* Each invocation reports its own error. */
+		lf_error_clear();
+		if (entry->type == fmr_user_invocation_class) {
+			results[i].value = fmr_perform_user_invocation(&entry->call, &results[i]);
+		} else {
+			results[i].value = fmr_execute(entry->call.index, entry->call.function, entry->call.ret, entry->call.argc, entry->call.types, entry->call.parameters);
+		}
+		results[i].error = lf_error_get();
+		results[i].sequence = packet->header.sequence;
+	}
+	return i;
+failure:
+	return lf_error;
+}
+
+lf_return_t fmr_deferred_count;
+lf_error_t fmr_deferred_error;
+
+lf_return_t fmr_push_inline(struct _fmr_push_pull_packet *packet) {
+	/* The data follows the parameters of the call. */
+	uint8_t *data = packet->call.parameters + fmr_parameters_size(&packet->call);
+	lf_assert(data + packet->length <= (uint8_t *)packet + packet->header.length, failure, E_FMR_OVERFLOW, "The inline data overruns the packet.");
+	*(uint64_t *)(packet->call.parameters) = (uintptr_t)data;
+	return fmr_execute(packet->call.index, packet->call.function, packet->call.ret, packet->call.argc, packet->call.types, (void *)(packet->call.parameters));
+failure:
+	return lf_error;
+}
+
+lf_return_t fmr_pull_inline(struct _fmr_push_pull_packet *packet, void *destination) {
+	lf_assert(packet->length <= FMR_INLINE_SIZE, failure, E_FMR_OVERFLOW, "Too much data (%i bytes) was requested inline.", packet->length);
+	*(uint64_t *)(packet->call.parameters) = (uintptr_t)destination;
+	return fmr_execute(packet->call.index, packet->call.function, packet->call.ret, packet->call.argc, packet->call.types, (void *)(packet->call.parameters));
+failure:
+	return lf_error;
+}
+
+lf_size_t fmr_perform(struct _fmr_packet *packet, struct _fmr_reply *reply) {
+	struct _fmr_result *result = &reply->result;
+	/* Only the result is sent back unless data is pulled inline. */
+	lf_size_t size = sizeof(struct _fmr_result);
+
+	/* Tag the result with the sequence number of the packet so that the host can match them. */
+	result->sequence = packet->header.sequence;
+
 	/* Check that the magic number matches. */
 	lf_assert(packet->header.magic == FMR_MAGIC_NUMBER, failure, E_CHECKSUM, "Invalid magic number.");
 
-	/* Ensure the packet's checksums match. */
-	lf_crc_t _crc = packet->header.checksum;
-	packet->header.checksum = 0x00;
-	uint16_t crc = lf_crc(packet, packet->header.length);
-	lf_assert(_crc == crc, failure, E_CHECKSUM, "Checksums do not match.");
+	/* Ensure the frame fits within the packet before it is checksummed. */
+	lf_assert(packet->header.length >= sizeof(struct _fmr_header) && packet->header.length <= sizeof(struct _fmr_packet), failure, E_FMR_OVERFLOW, "Invalid packet length.");
+
+	/* An inline pull is answered with its data even if it fails, so that the host receives the reply it expects. */
+	struct _fmr_push_pull_packet *pushpull = (struct _fmr_push_pull_packet *)(packet);
+	if (packet->header.type == fmr_inline_pull_class && pushpull->length <= FMR_INLINE_SIZE) {
+		memset(reply->data, 0, pushpull->length);
+		size += pushpull->length;
+	}
+
+	/* Ensure the packet's checksums match, unless it was sent over a transport that already detects corruption. */
+	if (!(packet->header.flags & FMR_FLAG_UNCHECKED) || !(fmr_configuration.capabilities & lf_capability_unchecked)) {
+		lf_crc_t _crc = packet->header.checksum;
+		packet->header.checksum = 0x00;
+		uint16_t crc = lf_crc(packet, packet->header.length);
+		lf_assert(_crc == crc, failure, E_CHECKSUM, "Checksums do not match.");
+	}
 
 	/* Cast the incoming packet to the different packet structures for subclass handling. */
 	struct _fmr_invocation *call = &((struct _fmr_invocation_packet *)packet)->call;
@@ -125,14 +252,42 @@ int fmr_perform(struct _fmr_packet *packet, struct _fmr_result *result) {
 		break;
 		case fmr_event_class:
 		break;
+		case fmr_batch_class:
+			result->value = fmr_batch((struct _fmr_batch_packet *)(packet));
+		break;
+		case fmr_inline_push_class:
+			result->value = fmr_push_inline(pushpull);
+		break;
+		case fmr_inline_pull_class:
+			result->value = fmr_pull_inline(pushpull, reply->data);
+		break;
+		case fmr_sync_class:
+			/* Report the failures of the packets performed without a reply, then forget them. */
+			result->value = fmr_deferred_count;
+			if (fmr_deferred_count) lf_error_raise(fmr_deferred_error, NULL);
+			fmr_deferred_count = 0;
+			fmr_deferred_error = E_OK;
+		break;
+		case fmr_configuration_class:
+			/* The configuration follows the result, whose value gives its size so that the host knows that one follows. */
+			memcpy(reply->data, &fmr_configuration, sizeof(struct _lf_configuration));
+			result->value = sizeof(struct _lf_configuration);
+			size += sizeof(struct _lf_configuration);
+		break;
 		default:
-			lf_assert(true, failure, E_SUBCLASS, "An invalid message runtime subclass was provided.");
+			lf_assert(false, failure, E_SUBCLASS, "An invalid message runtime subclass was provided.");
 		break;
 	}
 
-	result->error = lf_error_get();
-	return lf_success;
 failure:
 	result->error = lf_error_get();
-	return lf_error;
+	/* Packets that expect no reply record their failure until the host syncs. */
+	if (packet->header.flags & FMR_FLAG_NO_REPLY) {
+		if (result->error != E_OK) {
+			fmr_deferred_count ++;
+			fmr_deferred_error = result->error;
+		}
+		return 0;
+	}
+	return size;
 }
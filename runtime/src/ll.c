@@ -1,4 +1,8 @@
 #include <flipper.h>
+#include <flipper/slab.h>
+
+/* The nodes of every list are taken from a slab, so that building a list of arguments does not go through the heap. */
+LF_SLAB_DEFINE(lf_ll_slab, struct _lf_ll, LF_LL_POOL_SIZE);
 
 size_t lf_ll_count(struct _lf_ll *ll) {
 	size_t count = 0;
@@ -11,7 +15,8 @@ size_t lf_ll_count(struct _lf_ll *ll) {
 
 int lf_ll_append(struct _lf_ll **_ll, void *item, void *deconstructor) {
 	lf_assert(_ll, failure, E_NULL, "Invalid list reference provided to '%s'.", __PRETTY_FUNCTION__);
-	struct _lf_ll *new = malloc(sizeof(struct _lf_ll));
+	struct _lf_ll *new = lf_slab_alloc(&lf_ll_slab);
+	lf_assert(new, failure, E_MALLOC, "Failed to allocate memory for a new list node.");
 	memset(new, 0, sizeof(struct _lf_ll));
 	new->item = item;
 	new->deconstructor = deconstructor;
@@ -39,7 +44,7 @@ void lf_ll_free(struct _lf_ll **_ll) {
 	struct _lf_ll *ll = *_ll;
 	if (ll->deconstructor) ll->deconstructor(ll->item);
     *_ll = (*_ll)->next;
-	free(ll);
+	lf_slab_free(&lf_ll_slab, ll);
 }
 
 void lf_ll_remove(struct _lf_ll **_ll, void *item) {
@@ -0,0 +1,44 @@
+#include <flipper.h>
+#include <flipper/atomic.h>
+#include <flipper/lock.h>
+
+/* The number of threads that have asked for their identifier. */
+uint32_t lf_thread_count;
+LF_THREAD_LOCAL uint32_t lf_thread_self;
+
+uint32_t lf_thread_id(void) {
+	if (!lf_thread_self) lf_thread_self = lf_atomic_add(&lf_thread_count, 1);
+	return lf_thread_self;
+}
+
+void lf_lock(struct _lf_lock *lock) {
+	uint32_t self = lf_thread_id();
+	/* Only the holder can see itself as the owner, so this needs no further synchronization. */
+	if (lf_atomic_load(&lock->owner) == self) {
+		lock->depth ++;
+		return;
+	}
+	uint32_t state = 0;
+	if (!lf_atomic_cas(&lock->state, &state, 1)) {
+		/* Mark the lock as contended so that its holder wakes us, and sleep until it is released. */
+		while (lf_atomic_exchange(&lock->state, 2) != 0) lf_lock_wait(&lock->state, 2);
+	}
+	lf_atomic_store(&lock->owner, self);
+	lock->depth = 1;
+}
+
+void lf_unlock(struct _lf_lock *lock) {
+	if (-- lock->depth) return;
+	lf_atomic_store(&lock->owner, 0);
+	/* Only a lock that was contended can have a thread sleeping on it. */
+	if (lf_atomic_exchange(&lock->state, 0) == 2) lf_lock_wake(&lock->state);
+}
+
+/* Targets without threads never find a lock held by another, so they never wait. */
+LF_WEAK void lf_lock_wait(uint32_t *word, uint32_t value) {
+
+}
+
+LF_WEAK void lf_lock_wake(uint32_t *word) {
+
+}
@@ -1,11 +1,15 @@
 #include <flipper.h>
 #include <flipper/message.h>
 #include <flipper/event.h>
+#include <flipper/slab.h>
+
+/* Messages are taken from a slab, so that any thread can create them without going through the heap. */
+LF_SLAB_DEFINE(lf_msg_slab, struct _lf_msg, LF_MSG_POOL_SIZE);
 
 /* Creates a stub message body for a given kind of message. */
 struct _lf_msg *lf_msg_create(lf_msg_kind kind) {
-    struct _lf_msg *msg = malloc(sizeof(struct _lf_msg));
-    lf_assert(msg, failure, E_NULL, "NULL");
+    struct _lf_msg *msg = lf_slab_alloc(&lf_msg_slab);
+    lf_assert(msg, failure, E_MALLOC, "Failed to allocate memory for a new message.");
     memset(msg, 0, sizeof(struct _lf_msg));
     msg -> kind = kind;
     msg -> event_id = 0;
@@ -14,19 +18,70 @@ failure:
 	return NULL;
 }
 
-/* Sends a message to a specified device. This function blocks until the response message has been received. */
+/* Returns a message to the slab it was taken from. */
+void lf_msg_release(struct _lf_msg *msg) {
+    lf_slab_free(&lf_msg_slab, msg);
+}
+
+/* Sends a message over the endpoint. No result is sent back for a message, so this does not wait for the other side. */
 int lf_msg_send(struct _lf_msg *msg, struct _lf_endpoint *endpoint) {
+    lf_assert(msg && endpoint, failure, E_NULL, "NULL");
+    struct _fmr_message_packet packet;
+    memset(&packet, 0, sizeof(struct _fmr_message_packet));
+    packet.header.magic = FMR_MAGIC_NUMBER;
+    packet.header.length = sizeof(struct _fmr_message_packet);
+    packet.header.type = fmr_event_class;
+    packet.header.flags = FMR_FLAG_NO_REPLY;
+    packet.kind = msg -> kind;
+    packet.message_number = msg -> message_number;
+    packet.event_id = msg -> event_id;
+    /* Always checksummed, as the checksum is what tells a message apart from a result on the other side. */
+    packet.header.checksum = lf_crc(&packet, sizeof(struct _fmr_message_packet));
+    int _e = endpoint -> push(endpoint, &packet, sizeof(struct _fmr_message_packet));
+    lf_assert(_e == lf_success, failure, E_ENDPOINT, "Failed to send a message over the endpoint.");
     return lf_success;
+failure:
+    return lf_error;
+}
+
+/* Returns whether a frame pulled from an endpoint is a message, rather than a result. */
+bool lf_msg_framed(const struct _fmr_packet *packet) {
+    if (packet -> header.magic != FMR_MAGIC_NUMBER || packet -> header.type != fmr_event_class) return false;
+    if (packet -> header.length != sizeof(struct _fmr_message_packet)) return false;
+    struct _fmr_message_packet copy;
+    memcpy(&copy, packet, sizeof(struct _fmr_message_packet));
+    copy.header.checksum = 0x00;
+    return lf_crc(&copy, sizeof(struct _fmr_message_packet)) == packet -> header.checksum;
+}
+
+/* Creates the message carried by a frame pulled from the endpoint, and hands it to the thread that applies the endpoint's messages. */
+int lf_msg_receive(struct _lf_endpoint *endpoint, const struct _fmr_packet *packet) {
+    lf_assert(endpoint && packet, failure, E_NULL, "NULL");
+    lf_assert(lf_msg_framed(packet), failure, E_CHECKSUM, "The frame received over the endpoint is not a message.");
+    const struct _fmr_message_packet *frame = (const struct _fmr_message_packet *)packet;
+    struct _lf_msg *msg = lf_msg_create(frame -> kind);
+    lf_assert(msg, failure, E_MALLOC, "Failed to create a received message.");
+    msg -> message_number = frame -> message_number;
+    msg -> event_id = frame -> event_id;
+    lf_assert(lf_endpoint_deliver(endpoint, msg) == lf_success, release, E_OVERFLOW, "Failed to deliver a received message.");
+    return lf_success;
+release:
+    lf_msg_release(msg);
+failure:
+    return lf_error;
 }
 
 /* Creates a message receipt event for the outgoing packet. */
 int lf_msg_subscribe_receipt(struct _lf_msg *msg, lf_event_handler_func callback) {
     /* Generate a unique id to receive the message receipt event over. */
     lf_event_id id = lf_event_generate_unique_id();
-    lf_event_register(id, callback, NULL);
+    struct _lf_event *event = lf_event_register(id, callback, NULL);
+    lf_assert(event, failure, E_MALLOC, "Failed to register the receipt event for a message.");
     /* Set the message's recepit event id. */
     msg -> event_id = id;
     return lf_success;
+failure:
+    return lf_error;
 }
 
 /* Asynchronously sends a message to the given device. Invokes the callback function with the response message when the message returns. */
@@ -36,8 +91,7 @@ int lf_msg_send_async(struct _lf_msg *msg, struct _lf_endpoint *endpoint, lf_eve
         lf_msg_subscribe_receipt(msg, callback);
     }
     /* Queue the message to be sent over the device's endpoint. */
-    lf_endpoint_enqueue(endpoint, msg);
-    return lf_success;
+    return lf_endpoint_enqueue(endpoint, msg);
 }
 
 /* Handles a message locally. */
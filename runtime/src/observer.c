@@ -1,8 +1,11 @@
 #include <flipper.h>
+#include <flipper/slab.h>
+
+LF_SLAB_DEFINE(lf_observer_slab, struct _lf_observer, LF_OBSERVER_POOL_SIZE);
 
 struct _lf_observer *lf_observer_create(lf_event_id _id, struct _lf_endpoint *_endpoint) {
-    struct _lf_observer *observer = malloc(sizeof(struct _lf_observer));
-    lf_assert(observer, failure, E_NULL, "NULL");
+    struct _lf_observer *observer = lf_slab_alloc(&lf_observer_slab);
+    lf_assert(observer, failure, E_MALLOC, "Failed to allocate memory for a new observer.");
     observer -> event_id = _id;
     observer -> endpoint = _endpoint;
     return observer;
@@ -10,6 +13,11 @@ failure:
 	return NULL;
 }
 
+int lf_observer_release(struct _lf_observer *observer) {
+    lf_slab_free(&lf_observer_slab, observer);
+    return lf_success;
+}
+
 /* Registers the endpoint over which the last message was recieved as an observer to an event. */
 #warning This is a device function.
 int lf_observer_register(struct _lf_endpoint *endpoint, lf_event_id id) {
@@ -19,7 +27,11 @@ int lf_observer_register(struct _lf_endpoint *endpoint, lf_event_id id) {
     /* Obtain the event that we are registering this observer to. */
     struct _lf_event *event = lf_event_for_id(id);
     lf_assert(event, failure, E_NULL, "NULL");
-    return lf_ll_append(&(event -> observers), observer, free);
+    int _e = lf_vector_append(&(event -> observers), observer);
+    lf_assert(_e == lf_success, release, E_MALLOC, "Failed to add the observer to the event.");
+    return lf_success;
+release:
+    lf_observer_release(observer);
 failure:
 	return lf_error;
 }
@@ -29,8 +41,10 @@ void lf_observer_notify(const void *_observer, void *_unused) {
     lf_assert(observer, failure, E_NULL, "NULL");
     /* Send a message to the observer to notify it that an event was triggered. */
     struct _lf_msg *msg = lf_msg_create(lf_msg_event_kind);
+    lf_assert(msg, failure, E_MALLOC, "Failed to create a notification message.");
     msg -> event_id = observer -> event_id;
     lf_msg_send(msg, observer -> endpoint);
+    lf_msg_release(msg);
 failure:
     return;
 }
@@ -0,0 +1,77 @@
+#include <flipper.h>
+#include <flipper/atomic.h>
+#include <flipper/queue.h>
+
+void lf_queue_init(struct _lf_queue *queue, struct _lf_queue_cell *cells, uint32_t size) {
+	queue->mask = size - 1;
+	queue->head = queue->tail = 0;
+	queue->cells = cells;
+	/* A cell is free to be pushed into when its sequence matches the head. */
+	for (uint32_t i = 0; i < size; i ++) {
+		cells[i].sequence = i;
+		cells[i].item = NULL;
+	}
+}
+
+struct _lf_queue *lf_queue_create(uint32_t size) {
+	lf_assert(size && !(size & (size - 1)), failure, E_BOUNDARY, "The size of a queue must be a power of two.");
+	struct _lf_queue *queue = malloc(sizeof(struct _lf_queue) + size * sizeof(struct _lf_queue_cell));
+	lf_assert(queue, failure, E_MALLOC, "Failed to allocate memory for a new queue.");
+	lf_queue_init(queue, (struct _lf_queue_cell *)(queue + 1), size);
+	return queue;
+failure:
+	return NULL;
+}
+
+bool lf_queue_push(struct _lf_queue *queue, void *item) {
+	struct _lf_queue_cell *cell;
+	uint32_t position = lf_atomic_load(&queue->head);
+	for (;;) {
+		cell = &queue->cells[position & queue->mask];
+		int32_t difference = (int32_t)(lf_atomic_load(&cell->sequence) - position);
+		if (difference == 0) {
+			/* Claim the cell. If another push got to it first, the head that it left behind is tried instead. */
+			if (lf_atomic_cas(&queue->head, &position, position + 1)) break;
+		} else if (difference < 0) {
+			/* The cell still holds an item from the previous lap, so the queue is full. */
+			return false;
+		} else {
+			position = lf_atomic_load(&queue->head);
+		}
+	}
+	cell->item = item;
+	/* Publish the item to pops. */
+	lf_atomic_store(&cell->sequence, position + 1);
+	return true;
+}
+
+void *lf_queue_pop(struct _lf_queue *queue) {
+	struct _lf_queue_cell *cell;
+	uint32_t position = lf_atomic_load(&queue->tail);
+	for (;;) {
+		cell = &queue->cells[position & queue->mask];
+		int32_t difference = (int32_t)(lf_atomic_load(&cell->sequence) - (position + 1));
+		if (difference == 0) {
+			if (lf_atomic_cas(&queue->tail, &position, position + 1)) break;
+		} else if (difference < 0) {
+			/* The cell has not been pushed into yet, so the queue is empty. */
+			return NULL;
+		} else {
+			position = lf_atomic_load(&queue->tail);
+		}
+	}
+	void *item = cell->item;
+	/* Hand the cell back to pushes for the next lap. */
+	lf_atomic_store(&cell->sequence, position + queue->mask + 1);
+	return item;
+}
+
+bool lf_queue_empty(struct _lf_queue *queue) {
+	uint32_t position = lf_atomic_load(&queue->tail);
+	struct _lf_queue_cell *cell = &queue->cells[position & queue->mask];
+	return lf_atomic_load(&cell->sequence) != position + 1;
+}
+
+void lf_queue_release(struct _lf_queue *queue) {
+	free(queue);
+}
@@ -1,9 +1,10 @@
 #include <flipper.h>
 
-int lf_get_result(struct _lf_device *device, struct _fmr_result *result) {
+/* The functions below that take no lock are called with the device's lock held. */
+
+int lf_get_result(struct _lf_device *device, uint8_t sequence, struct _fmr_result *result) {
 	/* Obtain the response packet from the device. */
-	int _e = lf_retrieve(device, result);
-	lf_debug_result(result);
+	int _e = lf_retrieve_reply(device, sequence, result, sizeof(struct _fmr_result));
 	lf_assert(_e == lf_success, failure, E_ENDPOINT, "Failed to obtain response from device '%s':", device->configuration.name);
 	lf_assert(result->error == E_OK, failure, result->error, "An error occured on the device '%s':", device->configuration.name);
 	return lf_success;
@@ -12,8 +13,17 @@ failure:
 }
 
 int lf_transfer(struct _lf_device *device, struct _fmr_packet *packet) {
-	lf_debug_packet(packet, sizeof(struct _fmr_packet));
-	int _e = device->endpoint->push(device->endpoint, packet, sizeof(struct _fmr_packet));
+	lf_assert(packet->header.length <= device->frame_size, failure, E_FMR_OVERFLOW, "The packet is larger than the frames accepted by device '%s'.", device->configuration.name);
+	/* Devices whose transport already detects corruption do not need the packet to be checksummed. */
+	packet->header.checksum = 0x00;
+	if (device->configuration.capabilities & lf_capability_unchecked) {
+		packet->header.flags |= FMR_FLAG_UNCHECKED;
+	} else {
+		packet->header.checksum = lf_crc(packet, packet->header.length);
+	}
+	lf_debug_packet(packet, packet->header.length);
+	/* Only the bytes in use are sent. The device reads the header to learn how many follow. */
+	int _e = device->endpoint->push(device->endpoint, packet, packet->header.length);
 	lf_assert(_e == lf_success, failure, E_ENDPOINT, "Failed to transfer packet to device '%s'.", device->configuration.name);
 	return lf_success;
 failure:
@@ -28,29 +38,230 @@ failure:
 	return lf_error;
 }
 
-lf_return_t lf_invoke(struct _lf_module *module, lf_function function, lf_type ret, struct _lf_ll *parameters) {
+int lf_retrieve_reply(struct _lf_device *device, uint8_t sequence, void *reply, lf_size_t length) {
+	struct _fmr_result *result = reply;
+	/* Results of invocations that were abandoned may still arrive late. They are skipped, as by lf_retrieve_completion. */
+	for (int stale = 0; stale <= UINT8_MAX; stale ++) {
+		int _e = device->endpoint->pull(device->endpoint, reply, length);
+		lf_assert(_e == lf_success, failure, E_ENDPOINT, "Failed to retrieve packet from the device '%s'.", device->configuration.name);
+		lf_debug_result(result);
+		if (result->sequence == sequence) {
+			/* The device replies in order, so every late result has now been skipped. */
+			device->stale = false;
+			return lf_success;
+		}
+		lf_debug("Skipped a result with an unexpected sequence number (%i) from device '%s'.", result->sequence, device->configuration.name);
+	}
+	lf_assert(false, failure, E_FMR, "Received only results with unexpected sequence numbers from device '%s'.", device->configuration.name);
+failure:
+	/* The reply may yet arrive. */
+	device->stale = true;
+	return lf_error;
+}
+
+/* Fails every invocation still waiting for a result, so that a result that will never arrive is not waited on again. */
+void lf_abandon(struct _lf_device *device, lf_error_t error) {
+	for (size_t i = 0; i < LF_MAX_OUTSTANDING; i ++) {
+		struct _lf_completion *completion = &device->completions[i];
+		if (completion->state != lf_completion_pending) continue;
+		memset(&completion->result, 0, sizeof(struct _fmr_result));
+		completion->result.value = -1;
+		completion->result.error = error;
+		completion->result.sequence = completion->sequence;
+		completion->state = lf_completion_done;
+		device->stale = true;
+	}
+	device->outstanding = 0;
+}
+
+/* Files a result under the completion that is waiting for it. Returns false if no completion is waiting for it. */
+bool lf_complete(struct _lf_device *device, struct _fmr_result *result) {
+	/* Results are matched to their invocations by the sequence number echoed by the device. */
+	for (size_t i = 0; i < LF_MAX_OUTSTANDING; i ++) {
+		struct _lf_completion *completion = &device->completions[i];
+		if (completion->state != lf_completion_pending || completion->sequence != result->sequence) continue;
+		completion->result = *result;
+		completion->state = lf_completion_done;
+		device->outstanding --;
+		return true;
+	}
+	lf_debug("Skipped a result with an unexpected sequence number (%i) from device '%s'.", result->sequence, device->configuration.name);
+	return false;
+}
+
+/* Retrieves the next result from the device and files it under the completion that is waiting for it. If no result can be, every pending completion fails. */
+int lf_retrieve_completion(struct _lf_device *device) {
+	struct _fmr_result result;
+	/* Results of invocations that were abandoned may still arrive late. They are skipped, but only so many times as there are sequence numbers. */
+	for (int stale = 0; stale <= UINT8_MAX; stale ++) {
+		int _e = lf_retrieve(device, &result);
+		lf_debug_result(&result);
+		lf_assert(_e == lf_success, abandon, E_ENDPOINT, "Failed to obtain response from device '%s':", device->configuration.name);
+		if (lf_complete(device, &result)) return lf_success;
+	}
+	lf_assert(false, abandon, E_FMR, "Received only results with unexpected sequence numbers from device '%s'.", device->configuration.name);
+abandon:
+	lf_abandon(device, lf_error_get());
+	return lf_error;
+}
+
+int lf_drain(struct _lf_device *device) {
+	lf_assert(device, failure, E_NULL, "NULL device provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_lock(&device->lock);
+	while (device->outstanding) {
+		int _e = lf_retrieve_completion(device);
+		lf_assert(_e == lf_success, release, E_FMR, "Failed to retrieve an outstanding result from device '%s'.", device->configuration.name);
+	}
+	lf_unlock(&device->lock);
+	return lf_success;
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+/* Sends a sync and retrieves its reply, which follows the replies to every packet sent before it. Must be called with the device locked and drained. */
+int lf_exchange_sync(struct _lf_device *device, struct _fmr_result *result) {
+	struct _fmr_packet _packet;
+	memset(&_packet, 0, sizeof(struct _fmr_header));
+	_packet.header.magic = FMR_MAGIC_NUMBER;
+	_packet.header.length = sizeof(struct _fmr_header);
+	_packet.header.type = fmr_sync_class;
+	_packet.header.sequence = device->sequence ++;
+
+	/* The device performs packets in order, so its reply follows every packet sent before it. */
+	int _e = lf_transfer(device, &_packet);
+	lf_assert(_e == lf_success, failure, E_FMR, "Failed to transfer sync to device '%s'.", device->configuration.name);
+	device->unsynced = 0;
+
+	_e = lf_retrieve_reply(device, _packet.header.sequence, result, sizeof(struct _fmr_result));
+	lf_assert(_e == lf_success, failure, E_ENDPOINT, "Failed to obtain sync from device '%s'.", device->configuration.name);
+	/* Failures reported before 'lf_sync' was called are kept for it to report. */
+	if (result->error != E_OK) device->unreported = result->error;
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_sync(struct _lf_device *device) {
+	lf_assert(device, failure, E_NULL, "NULL device provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_lock(&device->lock);
+
+	/* The sync result must not interleave with outstanding results. */
+	int _e = lf_drain(device);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete outstanding invocations before syncing device '%s'.", device->configuration.name);
+
+	struct _fmr_result result;
+	_e = lf_exchange_sync(device, &result);
+	lf_assert(_e == lf_success, release, E_ENDPOINT, "Failed to sync device '%s'.", device->configuration.name);
+	lf_error_t error = device->unreported;
+	device->unreported = E_OK;
+	lf_assert(error == E_OK, release, error, "Invocations sent without a reply failed on the device '%s'. The last failure was:", device->configuration.name);
+	lf_unlock(&device->lock);
+	return lf_success;
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+int lf_load_configuration(struct _lf_device *device) {
+	lf_assert(device, failure, E_NULL, "NULL device provided to '%s'.", __PRETTY_FUNCTION__);
+	lf_lock(&device->lock);
+
+	/* The configuration must not interleave with outstanding results. */
+	int _e = lf_drain(device);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete outstanding invocations before configuring device '%s'.", device->configuration.name);
+
+	struct _fmr_packet _packet;
+	memset(&_packet, 0, sizeof(struct _fmr_header));
+	_packet.header.magic = FMR_MAGIC_NUMBER;
+	_packet.header.length = sizeof(struct _fmr_header);
+	_packet.header.type = fmr_configuration_class;
+	_packet.header.sequence = device->sequence ++;
+
+	_e = lf_transfer(device, &_packet);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to transfer configuration request to device '%s'.", device->configuration.name);
+
+	/* Firmware that predates the configuration packet answers with a bare result, so the configuration is only read once the result says that one follows. */
+	struct _fmr_result result;
+	_e = lf_retrieve_reply(device, _packet.header.sequence, &result, sizeof(struct _fmr_result));
+	struct _lf_configuration _configuration, *configuration = &_configuration;
+	memset(configuration, 0, sizeof(struct _lf_configuration));
+	bool follows = (_e == lf_success && result.error == E_OK && result.value == sizeof(struct _lf_configuration));
+	if (follows) {
+		_e = device->endpoint->pull(device->endpoint, configuration, sizeof(struct _lf_configuration));
+	}
+	if (!follows || _e != lf_success || !configuration->frame_size) {
+		/* Keep the defaults, which every device supports. */
+		lf_debug("Device '%s' did not report its configuration.", device->configuration.name);
+		lf_error_clear();
+		lf_unlock(&device->lock);
+		return lf_success;
+	}
+
+	/* Use the largest frames and the widest window that both sides support. */
+	device->configuration = *configuration;
+	device->frame_size = configuration->frame_size;
+	if (device->frame_size > FMR_MAX_PACKET_SIZE) device->frame_size = FMR_MAX_PACKET_SIZE;
+	if (device->frame_size < FMR_PACKET_SIZE) device->frame_size = FMR_PACKET_SIZE;
+	device->window = configuration->window;
+	if (device->window > LF_MAX_OUTSTANDING) device->window = LF_MAX_OUTSTANDING;
+	if (!device->window) device->window = 1;
+	lf_unlock(&device->lock);
+	return lf_success;
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+struct _lf_completion *lf_invoke_async(struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *parameters) {
 	lf_assert(module, failure, E_NULL, "No module was specified for function invocation.");
 
-	/* If the module has no device, assume the invocation is for the current device. */
-	if (!module->device) {
-		lf_debug("No device specified for module %s, using current device.", module->name);
-		module->device = lf_get_current_device();
+	/* Find where the module is invoked without binding it, so that threads using different devices do not fight over it. */
+	int index;
+	struct _lf_device *device = lf_resolve(module, NULL, &index);
+	lf_assert(device, failure, E_NO_DEVICE, "The module '%s' has no target device. Did you attach?", module->name);
+
+	lf_lock(&device->lock);
+
+	/* Functions that return nothing are not waited on when the device defers their errors. */
+	bool forget = (ret == lf_void_t && device->deferred);
+
+	/* Bound the number of packets the device may be working through without a reply. */
+	if (forget && device->unsynced >= LF_MAX_UNSYNCED) {
+		int _e = lf_sync(device);
+		lf_assert(_e == lf_success, release, lf_error_get(), "Invocations sent without a reply failed on device '%s'.", device->configuration.name);
 	}
 
-	lf_assert(module->device, failure, E_NO_DEVICE, "The module '%s' has no target device. Did you attach?", module->name);
+	/* If the window is full, make room by retrieving the oldest outstanding result. */
+	while (!forget && device->outstanding >= device->window) {
+		/* A failure abandons the outstanding invocations, which empties the window. Their awaiters report the failure, so this invocation goes ahead. */
+		if (lf_retrieve_completion(device) != lf_success) lf_error_clear();
+	}
 
-	/* If the module has no index, try to bind it. */
-	if (module->index == -1) lf_bind(module, module->device);
+	/* Find a completion through which the result of this invocation can be tracked. */
+	struct _lf_completion *completion = NULL;
+	for (size_t i = 0; i < LF_MAX_OUTSTANDING; i ++) {
+		if (device->completions[i].state == lf_completion_free) {
+			completion = &device->completions[i];
+			break;
+		}
+	}
+	lf_assert(completion, release, E_OVERFLOW, "Too many invocations on device '%s' have not been awaited.", device->configuration.name);
 
 	/* The raw packet into which the invocation information will be loaded .*/
 	struct _fmr_packet _packet;
 	memset(&_packet, 0, sizeof(struct _fmr_packet));
 	_packet.header.magic = FMR_MAGIC_NUMBER;
 	_packet.header.length = sizeof(struct _fmr_invocation_packet);
+	_packet.header.sequence = device->sequence;
+	if (forget) _packet.header.flags = FMR_FLAG_NO_REPLY;
 
 	#warning Remove this.
 	/* If the user module bit is set, make the invocation a user invocation. */
-	if (module->index & FMR_USER_INVOCATION_BIT) {
+	if (index & FMR_USER_INVOCATION_BIT) {
 		_packet.header.type = fmr_user_invocation_class;
 	} else {
 		/* Otherwise, make it a standard invocation. */
@@ -59,86 +270,315 @@ lf_return_t lf_invoke(struct _lf_module *module, lf_function function, lf_type r
 
 	/* Generate the function call in the outgoing packet. */
 	struct _fmr_invocation_packet *packet = (struct _fmr_invocation_packet *)(&_packet);
-	int _e = lf_create_call((uint8_t)(module->index), function, ret, parameters, &_packet.header, &packet->call);
-	lf_assert(_e == lf_success, failure, E_NULL, "Failed to generate a valid call to module '%s'.", module->name);
-	_packet.header.checksum = lf_crc(&_packet, _packet.header.length);
+	int _e = lf_create_call((uint8_t)index, function, ret, parameters, &_packet.header, &packet->call);
+	lf_assert(_e == lf_success, release, E_NULL, "Failed to generate a valid call to module '%s'.", module->name);
+
+	_e = lf_transfer(device, &_packet);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to transfer command to module '%s'.", module->name);
+
+	completion->device = device;
+	completion->sequence = device->sequence ++;
+	if (forget) {
+		/* There is no result to wait for, so the completion is done as soon as the packet is sent. */
+		memset(&completion->result, 0, sizeof(struct _fmr_result));
+		completion->state = lf_completion_done;
+		device->unsynced ++;
+	} else {
+		completion->state = lf_completion_pending;
+		device->outstanding ++;
+	}
+	lf_unlock(&device->lock);
+	/* The completion keeps the device retained until it is awaited. */
+	return completion;
 
-	_e = lf_transfer(module->device, &_packet);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to transfer command to module '%s'.", module->name);
+release:
+	lf_unlock(&device->lock);
+	lf_device_release(device);
+failure:
+	return NULL;
+}
 
-	struct _fmr_result result;
-	lf_get_result(module->device, &result);
+lf_return_t lf_await(struct _lf_completion *completion) {
+	lf_assert(completion && completion->state != lf_completion_free, failure, E_NULL, "Invalid completion provided to '%s'.", __PRETTY_FUNCTION__);
+	struct _lf_device *device = completion->device;
+	lf_lock(&device->lock);
+	/* Retrieve results until the one belonging to this completion arrives. Another thread may retrieve it for us. A failure abandons it along with the others, ending the wait. */
+	while (completion->state == lf_completion_pending) {
+		lf_retrieve_completion(device);
+	}
+	/* Copy the result out before the completion can be reused. */
+	struct _fmr_result result = completion->result;
+	completion->state = lf_completion_free;
+	lf_unlock(&device->lock);
+	if (result.error != E_OK) {
+		lf_error_raise(result.error, error_message("An error occured on the device '%s':", device->configuration.name));
+	}
+	/* Drop the reference taken when the invocation was sent. */
+	lf_device_release(device);
 	return result.value;
-
 failure:
 	return -1;
 }
 
-lf_return_t lf_push(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _lf_ll *parameters) {
-	lf_assert(module, failure, E_NULL, "NULL module was specified for data push.");
-	lf_assert(module->index != -1, failure, E_MODULE, "The module '%s' has not been configured. Call '%s_configure()' first.", module->name, module->name);
-	lf_assert(module->device, failure, E_NO_DEVICE, "The module '%s' has no target device. Did you attach before configuring?", module->name);
+lf_return_t lf_invoke(struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *parameters) {
+	struct _lf_completion *completion = lf_invoke_async(module, function, ret, parameters);
+	if (!completion) return -1;
+	return lf_await(completion);
+}
+
+int lf_batch_begin(struct _lf_batch *batch, struct _lf_device *device) {
+	lf_assert(batch, failure, E_NULL, "NULL batch provided to '%s'.", __PRETTY_FUNCTION__);
+	/* If no device is specified, assume the batch is for the current device. */
+	if (!device) device = lf_get_current_device();
+	lf_assert(device, failure, E_NO_DEVICE, "The batch has no target device. Did you attach?");
+	lf_assert(device->configuration.capabilities & lf_capability_batch, failure, E_CONFIGURATION, "The device '%s' does not support batched invocations.", device->configuration.name);
+	batch->device = device;
+	memset(&batch->packet, 0, sizeof(struct _fmr_packet));
+	batch->packet.header.magic = FMR_MAGIC_NUMBER;
+	batch->packet.header.length = sizeof(struct _fmr_batch_packet);
+	batch->packet.header.type = fmr_batch_class;
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+int lf_batch_add(struct _lf_batch *batch, struct _lf_module *module, lf_function function, lf_type ret, struct _fmr_args *parameters) {
+	lf_assert(batch && batch->device, failure, E_NULL, "Invalid batch provided to '%s'. Call 'lf_batch_begin' first.", __PRETTY_FUNCTION__);
+	lf_assert(module, failure, E_NULL, "No module was specified for batched invocation.");
+
+	/* If the module has no device, assume the invocation is for the device of the batch. */
+	int index;
+	struct _lf_device *device = lf_resolve(module, batch->device, &index);
+	lf_device_release(device);
+	lf_assert(device && device == batch->device, failure, E_NO_DEVICE, "The module '%s' is not bound to the device of the batch.", module->name);
+
+	struct _fmr_batch_packet *packet = (struct _fmr_batch_packet *)(&batch->packet);
+	lf_assert(packet->count < FMR_MAX_BATCH, failure, E_OVERFLOW, "A batch cannot hold more than %i invocations.", FMR_MAX_BATCH);
+	lf_assert(!parameters || parameters->argc != FMR_ARGS_INVALID, failure, E_OVERFLOW, "The arguments of the batched call to module '%s' could not be encoded.", module->name);
+
+	/* Ensure that the invocation and its parameters will fit within the packet. */
+	lf_size_t size = sizeof(struct _fmr_batch_entry) + ((parameters) ? parameters->size : 0);
+	lf_assert(packet->header.length + size <= batch->device->frame_size, failure, E_FMR_OVERFLOW, "The invocation of module '%s' does not fit in the batch. Commit the batch first.", module->name);
+
+	/* Append the invocation to the end of the packet. */
+	struct _fmr_batch_entry *entry = (struct _fmr_batch_entry *)((uint8_t *)packet + packet->header.length);
+	entry->type = (index & FMR_USER_INVOCATION_BIT) ? fmr_user_invocation_class : fmr_standard_invocation_class;
+	packet->header.length += sizeof(struct _fmr_batch_entry);
+	int _e = lf_create_call((uint8_t)index, function, ret, parameters, &packet->header, &entry->call);
+	lf_assert(_e == lf_success, failure, E_NULL, "Failed to generate a valid batched call to module '%s'.", module->name);
+	packet->count ++;
+	return lf_success;
+
+failure:
+	return lf_error;
+}
+
+int lf_batch_commit(struct _lf_batch *batch, struct _fmr_result *results) {
+	lf_assert(batch && batch->device, failure, E_NULL, "Invalid batch provided to '%s'. Call 'lf_batch_begin' first.", __PRETTY_FUNCTION__);
+	struct _lf_device *device = batch->device;
+	struct _fmr_batch_packet *packet = (struct _fmr_batch_packet *)(&batch->packet);
+	if (!packet->count) return lf_success;
+	lf_lock(&device->lock);
+
+	/* The result vector must not interleave with outstanding results. */
+	int _e = lf_drain(device);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete outstanding invocations before committing batch to device '%s'.", device->configuration.name);
+
+	packet->header.sequence = device->sequence ++;
+
+	/* Send the packet to the target device. */
+	_e = lf_transfer(device, &batch->packet);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to transfer batch to device '%s'.", device->configuration.name);
+
+	/* Obtain the result of each invocation in the batch. */
+	struct _fmr_result _results[FMR_MAX_BATCH];
+	if (!results) results = _results;
+	lf_argc count = packet->count;
+	_e = lf_retrieve_reply(device, packet->header.sequence, results, count * sizeof(struct _fmr_result));
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to retrieve batch results from device '%s'.", device->configuration.name);
+
+	struct _fmr_result result;
+	_e = lf_get_result(device, packet->header.sequence, &result);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete batch on device '%s'.", device->configuration.name);
+	lf_unlock(&device->lock);
+
+	/* Leave the batch empty so that it can be reused. */
+	lf_batch_begin(batch, device);
+
+	for (lf_argc i = 0; i < count; i ++) {
+		lf_assert(results[i].error == E_OK, failure, results[i].error, "Invocation %i of the batch failed on the device '%s':", i, device->configuration.name);
+	}
+	return lf_success;
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+/* Performs a push on the device that the module was resolved to. */
+lf_return_t lf_push_device(struct _lf_device *device, struct _lf_module *module, int index, lf_function function, void *source, lf_size_t length, struct _fmr_args *parameters) {
+	/* A push whose arguments failed to encode is not sent. */
+	lf_assert(!parameters || parameters->argc != FMR_ARGS_INVALID, failure, E_OVERFLOW, "The arguments of the push to module '%s' could not be encoded.", module->name);
 	if (!length) return lf_success;
+	lf_lock(&device->lock);
+
+	/* The data transfer must not interleave with outstanding results. */
+	int _e = lf_drain(device);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete outstanding invocations before push to module '%s'.", module->name);
 
 	struct _fmr_packet _packet;
 	memset(&_packet, 0, sizeof(struct _fmr_packet));
 	_packet.header.magic = FMR_MAGIC_NUMBER;
 	_packet.header.length = sizeof(struct _fmr_push_pull_packet);
 	_packet.header.type = fmr_push_class;
+	_packet.header.sequence = device->sequence ++;
 	struct _fmr_push_pull_packet *packet = (struct _fmr_push_pull_packet *)(&_packet);
 	packet->length = length;
 
-	int _e = lf_create_call(module->index, function, lf_int_t, lf_args(lf_ptr(source), lf_infer(length)), &_packet.header, &packet->call);
-	lf_assert(_e == lf_success, failure, E_NULL, "Failed to generate a valid push to module '%s'.", module->name);
-	_packet.header.checksum = lf_crc(packet, _packet.header.length);
+	_e = lf_create_call(index, function, lf_int_t, lf_args(lf_ptr(source), lf_infer(length)), &_packet.header, &packet->call);
+	lf_assert(_e == lf_success, release, E_NULL, "Failed to generate a valid push to module '%s'.", module->name);
+
+	/* Small amounts of data are carried after the parameters of the call, saving a separate transfer. */
+	bool inline_capable = device->configuration.capabilities & lf_capability_inline;
+	if (inline_capable && length <= FMR_INLINE_SIZE && _packet.header.length + length <= device->frame_size) {
+		_packet.header.type = fmr_inline_push_class;
+		memcpy((uint8_t *)&_packet + _packet.header.length, source, length);
+		_packet.header.length += length;
+	}
 
 	/* Send the packet to the target device. */
-	_e = lf_transfer(module->device, &_packet);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to transfer push command to module '%s'.", module->name);
+	_e = lf_transfer(device, &_packet);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to transfer push command to module '%s'.", module->name);
 
-	/* Transfer the data through to the address space of the device. */
-	_e = module->device->endpoint->push(module->device->endpoint, source, length);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to push data to module '%s'.", module->name);
+	if (_packet.header.type == fmr_push_class) {
+		/* Transfer the data through to the address space of the device. */
+		_e = device->endpoint->push(device->endpoint, source, length);
+		lf_assert(_e == lf_success, release, E_FMR, "Failed to push data to module '%s'.", module->name);
+	}
 
 	struct _fmr_result result;
-	lf_get_result(module->device, &result);
-	return result.value;
+	_e = lf_get_result(device, _packet.header.sequence, &result);
+	lf_unlock(&device->lock);
+	return (_e == lf_success) ? result.value : (lf_return_t)lf_error;
 
+release:
+	lf_unlock(&device->lock);
 failure:
 	return lf_error;
 }
 
-lf_return_t lf_pull(struct _lf_module *module, lf_function function, void *destination, lf_size_t length, struct _lf_ll *parameters) {
-	lf_assert(module, failure, E_NULL, "NULL module was specified for data pull.");
-	lf_assert(module->index != -1, failure, E_MODULE, "The module '%s' has not been configured. Call '%s_configure()' first.", module->name, module->name);
-	lf_assert(module->device, failure, E_NO_DEVICE, "The module '%s' has no target device. Did you attach before configuring?", module->name);
+lf_return_t lf_push(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _fmr_args *parameters) {
+	lf_assert(module, failure, E_NULL, "NULL module was specified for data push.");
+	int index;
+	struct _lf_device *device = lf_resolve(module, NULL, &index);
+	lf_assert(device, failure, E_NO_DEVICE, "The module '%s' has no target device. Did you attach before configuring?", module->name);
+	lf_return_t value = lf_push_device(device, module, index, function, source, length, parameters);
+	lf_device_release(device);
+	return value;
+failure:
+	return lf_error;
+}
+
+/* Performs a pull on the device that the module was resolved to. */
+lf_return_t lf_pull_device(struct _lf_device *device, struct _lf_module *module, int index, lf_function function, void *destination, lf_size_t length, struct _fmr_args *parameters) {
+	/* A pull whose arguments failed to encode is not sent. */
+	lf_assert(!parameters || parameters->argc != FMR_ARGS_INVALID, failure, E_OVERFLOW, "The arguments of the pull from module '%s' could not be encoded.", module->name);
 	if (!length) return lf_success;
+	lf_lock(&device->lock);
+
+	/* The data transfer must not interleave with outstanding results. */
+	int _e = lf_drain(device);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete outstanding invocations before pull from module '%s'.", module->name);
+
+	/* Data pulled in a transfer of its own carries no sequence number, so late results must be skipped before it is asked for. */
+	if (device->stale && !((device->configuration.capabilities & lf_capability_inline) && length <= FMR_INLINE_SIZE)) {
+		struct _fmr_result synced;
+		_e = lf_exchange_sync(device, &synced);
+		lf_assert(_e == lf_success, release, E_FMR, "Failed to skip late results before pull from module '%s'.", module->name);
+	}
 
 	struct _fmr_packet _packet;
 	memset(&_packet, 0, sizeof(struct _fmr_packet));
 	_packet.header.magic = FMR_MAGIC_NUMBER;
 	_packet.header.length = sizeof(struct _fmr_push_pull_packet);
 	_packet.header.type = fmr_pull_class;
+	_packet.header.sequence = device->sequence ++;
 	struct _fmr_push_pull_packet *packet = (struct _fmr_push_pull_packet *)(&_packet);
 	packet->length = length;
 
 	/* Generate the function call in the outgoing packet. */
-	int _e = lf_create_call(module->index, function, lf_int_t, lf_args(lf_ptr(destination), lf_infer(length)), &_packet.header, &packet->call);
-	lf_assert(_e == lf_success, failure, E_NULL, "Failed to generate a valid pull from module '%s'.", module->name);
-	_packet.header.checksum = lf_crc(packet, _packet.header.length);
+	_e = lf_create_call(index, function, lf_int_t, lf_args(lf_ptr(destination), lf_infer(length)), &_packet.header, &packet->call);
+	lf_assert(_e == lf_success, release, E_NULL, "Failed to generate a valid pull from module '%s'.", module->name);
+
+	/* Small amounts of data are returned along with the result, saving a separate transfer. */
+	if ((device->configuration.capabilities & lf_capability_inline) && length <= FMR_INLINE_SIZE) _packet.header.type = fmr_inline_pull_class;
 
 	/* Send the packet to the target device. */
-	_e = lf_transfer(module->device, &_packet);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to transfer pull command to module '%s'.", module->name);
+	_e = lf_transfer(device, &_packet);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to transfer pull command to module '%s'.", module->name);
+
+	if (_packet.header.type == fmr_inline_pull_class) {
+		struct _fmr_reply reply;
+		_e = lf_retrieve_reply(device, _packet.header.sequence, &reply, sizeof(struct _fmr_result) + length);
+		lf_assert(_e == lf_success, release, E_FMR, "Failed to pull data from module '%s'.", module->name);
+		lf_unlock(&device->lock);
+		memcpy(destination, reply.data, length);
+		lf_assert(reply.result.error == E_OK, failure, reply.result.error, "An error occured on the device '%s':", device->configuration.name);
+		return reply.result.value;
+	}
 
 	/* Obtain the data from the address space of the device. */
-	_e = module->device->endpoint->pull(module->device->endpoint, destination, length);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to pull data from module '%s'.", module->name);
+	_e = device->endpoint->pull(device->endpoint, destination, length);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to pull data from module '%s'.", module->name);
 
 	struct _fmr_result result;
-	lf_get_result(module->device, &result);
-	return result.value;
+	_e = lf_get_result(device, _packet.header.sequence, &result);
+	lf_unlock(&device->lock);
+	return (_e == lf_success) ? result.value : (lf_return_t)lf_error;
 
+release:
+	lf_unlock(&device->lock);
+failure:
+	return lf_error;
+}
+
+lf_return_t lf_pull(struct _lf_module *module, lf_function function, void *destination, lf_size_t length, struct _fmr_args *parameters) {
+	lf_assert(module, failure, E_NULL, "NULL module was specified for data pull.");
+	int index;
+	struct _lf_device *device = lf_resolve(module, NULL, &index);
+	lf_assert(device, failure, E_NO_DEVICE, "The module '%s' has no target device. Did you attach before configuring?", module->name);
+	lf_return_t value = lf_pull_device(device, module, index, function, destination, length, parameters);
+	lf_device_release(device);
+	return value;
+failure:
+	return lf_error;
+}
+
+/* ~ Shims for language bindings that construct argument lists. ~ */
+
+lf_return_t lf_invoke_ll(struct _lf_module *module, lf_function function, lf_type ret, struct _lf_ll *list) {
+	struct _fmr_args args;
+	int _e = fmr_args_from_list(&args, list);
+	lf_assert(_e == lf_success, failure, E_NULL, "Failed to encode the arguments of a call to module '%s'.", (module) ? module->name : "");
+	return lf_invoke(module, function, ret, &args);
+failure:
+	return -1;
+}
+
+lf_return_t lf_push_ll(struct _lf_module *module, lf_function function, void *source, lf_size_t length, struct _lf_ll *list) {
+	struct _fmr_args args;
+	int _e = fmr_args_from_list(&args, list);
+	lf_assert(_e == lf_success, failure, E_NULL, "Failed to encode the arguments of a push to module '%s'.", (module) ? module->name : "");
+	return lf_push(module, function, source, length, &args);
+failure:
+	return lf_error;
+}
+
+lf_return_t lf_pull_ll(struct _lf_module *module, lf_function function, void *destination, lf_size_t length, struct _lf_ll *list) {
+	struct _fmr_args args;
+	int _e = fmr_args_from_list(&args, list);
+	lf_assert(_e == lf_success, failure, E_NULL, "Failed to encode the arguments of a pull from module '%s'.", (module) ? module->name : "");
+	return lf_pull(module, function, destination, length, &args);
 failure:
 	return lf_error;
 }
@@ -147,28 +587,41 @@ int lf_load(void *source, lf_size_t length, struct _lf_device *device) {
 	lf_assert(device, failure, E_NULL, "No device specified for RAM load.");
 	lf_assert(source, failure, E_NULL, "No source specified for RAM load to device '%s'.", device->configuration.name);
 	lf_assert(length, failure, E_NULL, "No length specified for RAM load to device '%s'.", device->configuration.name);
+	lf_lock(&device->lock);
+
+	/* The image transfer must not interleave with outstanding results. */
+	int _e = lf_drain(device);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to complete outstanding invocations before RAM load to device '%s'.", device->configuration.name);
 
 	struct _fmr_packet _packet;
 	memset(&_packet, 0, sizeof(struct _fmr_packet));
 	_packet.header.magic = FMR_MAGIC_NUMBER;
 	_packet.header.length = sizeof(struct _fmr_push_pull_packet);
 	_packet.header.type = fmr_ram_load_class;
+	_packet.header.sequence = device->sequence ++;
 	struct _fmr_push_pull_packet *packet = (struct _fmr_push_pull_packet *)(&_packet);
 	packet->length = length;
-	_packet.header.checksum = lf_crc(packet, _packet.header.length);
 
 	/* Send the packet to the target device. */
-	int _e = lf_transfer(device, &_packet);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to transfer load command to device '%s'.", device->configuration.name);
+	_e = lf_transfer(device, &_packet);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to transfer load command to device '%s'.", device->configuration.name);
 
 	/* Transfer the data through to the address space of the device. */
 	_e = device->endpoint->push(device->endpoint, source, length);
-	lf_assert(_e == lf_success, failure, E_FMR, "Failed to push image data to device '%s'.", device->configuration.name);
+	lf_assert(_e == lf_success, release, E_FMR, "Failed to push image data to device '%s'.", device->configuration.name);
+
+	/* The image may have added or replaced a module, so the cached module table and the modules located through it are stale. */
+	device->module_count = -1;
+	device->located_count = 0;
+	device->loads ++;
 
 	struct _fmr_result result;
-	lf_get_result(device, &result);
-	return result.value;
+	_e = lf_get_result(device, _packet.header.sequence, &result);
+	lf_unlock(&device->lock);
+	return (_e == lf_success) ? result.value : (lf_return_t)lf_error;
 
+release:
+	lf_unlock(&device->lock);
 failure:
 	return lf_error;
 }
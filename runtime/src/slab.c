@@ -0,0 +1,54 @@
+#include <flipper.h>
+#include <flipper/atomic.h>
+#include <flipper/slab.h>
+
+/* Returns the free list with its first object replaced, and its tag advanced so that a stale compare and swap cannot succeed. */
+#define lf_slab_top(top, first) ((((top) + 0x10000) & 0xffff0000) | (first))
+
+void *lf_slab_alloc(struct _lf_slab *slab) {
+	/* Reuse the object freed most recently, as it is the most likely to still be in the cache. */
+	uint32_t top = lf_atomic_load(&slab->top);
+	while (top & 0xffff) {
+		uint32_t index = (top & 0xffff) - 1;
+		uint32_t next = lf_atomic_load(&slab->links[index]);
+		if (lf_atomic_cas(&slab->top, &top, lf_slab_top(top, next))) return slab->objects + index * slab->size;
+	}
+	/* Only once every object that has been used is in use again is one taken that never has been. */
+	uint32_t fresh = lf_atomic_load(&slab->fresh);
+	while (fresh < slab->count) {
+		if (lf_atomic_cas(&slab->fresh, &fresh, fresh + 1)) return slab->objects + fresh * slab->size;
+	}
+	lf_atomic_add(&slab->exhausted, 1);
+	lf_assert(slab->overflow, failure, E_MALLOC, "All %u of the slab's '%s' objects are in use.", (unsigned)slab->count, slab->name);
+	void *object = malloc(slab->size);
+	lf_assert(object, failure, E_MALLOC, "Failed to allocate memory for a '%s' beyond those in its slab.", slab->name);
+	return object;
+failure:
+	return NULL;
+}
+
+bool lf_slab_owns(struct _lf_slab *slab, void *object) {
+	uint8_t *address = object;
+	return address >= slab->objects && address < slab->objects + slab->count * slab->size;
+}
+
+void lf_slab_free(struct _lf_slab *slab, void *object) {
+	if (!object) return;
+	if (!lf_slab_owns(slab, object)) {
+		free(object);
+		return;
+	}
+	uint32_t index = ((uint8_t *)object - slab->objects) / slab->size;
+	uint32_t top = lf_atomic_load(&slab->top);
+	do {
+		lf_atomic_store(&slab->links[index], top & 0xffff);
+	} while (!lf_atomic_cas(&slab->top, &top, lf_slab_top(top, index + 1)));
+}
+
+void lf_slab_report(struct _lf_slab *slab) {
+	uint32_t fresh = lf_atomic_load(&slab->fresh);
+	/* Every object that has been used and is not on the free list is in use. */
+	uint32_t free = 0;
+	for (uint32_t first = lf_atomic_load(&slab->top) & 0xffff; first && free < fresh; first = lf_atomic_load(&slab->links[first - 1])) free ++;
+	printf("%s: %u of %u in use, at most %u, exhausted %u times.\n", slab->name, (unsigned)(fresh - free), (unsigned)slab->count, (unsigned)fresh, (unsigned)lf_atomic_load(&slab->exhausted));
+}
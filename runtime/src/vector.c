@@ -0,0 +1,71 @@
+#include <flipper.h>
+#include <flipper/vector.h>
+
+void lf_vector_init(struct _lf_vector *vector, void *deconstructor) {
+	vector->items = NULL;
+	vector->count = vector->capacity = 0;
+	vector->deconstructor = deconstructor;
+}
+
+int lf_vector_append(struct _lf_vector *vector, void *item) {
+	lf_assert(vector, failure, E_NULL, "Invalid vector provided to '%s'.", __PRETTY_FUNCTION__);
+	if (vector->count == vector->capacity) {
+		/* Double the capacity, so that the cost of growing is spread thinly over the appends. */
+		uint32_t capacity = (vector->capacity) ? vector->capacity * 2 : LF_VECTOR_INITIAL_CAPACITY;
+		lf_assert(capacity > vector->capacity, failure, E_OVERFLOW, "The vector cannot hold any more items.");
+		void **items = realloc(vector->items, capacity * sizeof(void *));
+		lf_assert(items, failure, E_MALLOC, "Failed to allocate memory to grow a vector.");
+		vector->items = items;
+		vector->capacity = capacity;
+	}
+	vector->items[vector->count ++] = item;
+	return lf_success;
+failure:
+	return lf_error;
+}
+
+bool lf_vector_contains(struct _lf_vector *vector, void *item) {
+	lf_assert(vector, failure, E_NULL, "Invalid vector provided to '%s'.", __PRETTY_FUNCTION__);
+	for (uint32_t i = 0; i < vector->count; i ++) {
+		if (vector->items[i] == item) return true;
+	}
+failure:
+	return false;
+}
+
+void lf_vector_remove(struct _lf_vector *vector, void *item) {
+	lf_assert(vector, failure, E_NULL, "Invalid vector provided to '%s'.", __PRETTY_FUNCTION__);
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < vector->count; i ++) {
+		if (vector->items[i] == item) {
+			if (vector->deconstructor) vector->deconstructor(item);
+		} else {
+			vector->items[kept ++] = vector->items[i];
+		}
+	}
+	vector->count = kept;
+failure:
+	return;
+}
+
+void lf_vector_apply_func(struct _lf_vector *vector, lf_ll_applier_func func, void *_ctx) {
+	lf_assert(vector && func, failure, E_NULL, "Invalid parameter provided to '%s'.", __PRETTY_FUNCTION__);
+	for (uint32_t i = 0; i < vector->count; i ++) {
+		func(vector->items[i], _ctx);
+	}
+failure:
+	return;
+}
+
+int lf_vector_release(struct _lf_vector *vector) {
+	lf_assert(vector, failure, E_NULL, "Invalid vector provided to '%s'.", __PRETTY_FUNCTION__);
+	if (vector->deconstructor) {
+		for (uint32_t i = 0; i < vector->count; i ++) vector->deconstructor(vector->items[i]);
+	}
+	free(vector->items);
+	vector->items = NULL;
+	vector->count = vector->capacity = 0;
+	return lf_success;
+failure:
+	return lf_error;
+}
@@ -0,0 +1,64 @@
+/* args.c - Checks that calls whose arguments cannot be encoded fail without being sent, rather than being sent without their arguments. */
+
+#include "device.h"
+
+/* An argument of a type that does not exist. */
+#define lf_bad(arg) (lf_max_t + 1), (lf_arg)(arg)
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+	uint8_t data[64];
+	memset(data, 1, sizeof(data));
+
+	/* Arguments that encode are passed on. */
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(7))) == 7, "A call with valid arguments failed.");
+	lf_test(lf_args(lf_uint32(7))->argc == 1, "A valid argument vector counts %u arguments.", lf_args(lf_uint32(7))->argc);
+
+	/* An argument that cannot be encoded marks the vector, rather than leaving it to look like one without arguments. */
+	lf_error_pause();
+	struct _fmr_args *invalid = lf_args(lf_uint32(7), lf_bad(8));
+	lf_test(invalid && invalid->argc == FMR_ARGS_INVALID, "An argument vector that failed to build was not marked invalid.");
+	uint32_t packets = context->packets;
+	lf_error_clear();
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_bad(7))) == (lf_return_t)-1 && lf_error_get() != E_OK, "An invocation with invalid arguments succeeded.");
+	lf_error_clear();
+	lf_test(!lf_invoke_async(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_bad(7))) && lf_error_get() != E_OK, "An asynchronous invocation with invalid arguments was sent.");
+	lf_error_clear();
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, sizeof(data), lf_args(lf_bad(7))) == (lf_return_t)lf_error && lf_error_get() == E_OVERFLOW, "A push with invalid arguments succeeded.");
+	lf_error_clear();
+	lf_test(lf_pull(&module, lf_test_fmr_load_f, data, sizeof(data), lf_args(lf_bad(7))) == (lf_return_t)lf_error && lf_error_get() == E_OVERFLOW, "A pull with invalid arguments succeeded.");
+	lf_error_clear();
+
+	/* A batch refuses the call, and keeps those it already holds. */
+	struct _lf_batch batch;
+	lf_test(lf_batch_begin(&batch, device) == lf_success, "Failed to begin a batch.");
+	lf_test(lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(1))) == lf_success, "Failed to add to a batch.");
+	lf_test(lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_bad(2))) == lf_error, "A call with invalid arguments was added to a batch.");
+	lf_error_clear();
+
+	/* The shims fail in the same way when their list holds more arguments than a call can. */
+	struct _lf_ll *list = NULL;
+	for (int i = 0; i <= FMR_MAX_ARGC; i ++) lf_ll_append(&list, lf_arg_create(lf_uint8_t, i), lf_arg_release);
+	lf_test(lf_invoke_ll(&module, lf_test_fmr_echo_f, lf_uint32_t, list) == (lf_return_t)-1, "An invocation with too many arguments succeeded.");
+	lf_error_clear();
+	list = NULL;
+	for (int i = 0; i <= FMR_MAX_ARGC; i ++) lf_ll_append(&list, lf_arg_create(lf_uint8_t, i), lf_arg_release);
+	lf_test(lf_push_ll(&module, lf_test_fmr_store_f, data, sizeof(data), list) == (lf_return_t)lf_error, "A push with too many arguments succeeded.");
+	lf_error_clear();
+	list = NULL;
+	for (int i = 0; i <= FMR_MAX_ARGC; i ++) lf_ll_append(&list, lf_arg_create(lf_uint8_t, i), lf_arg_release);
+	lf_test(lf_pull_ll(&module, lf_test_fmr_load_f, data, sizeof(data), list) == (lf_return_t)lf_error, "A pull with too many arguments succeeded.");
+	lf_error_clear();
+	lf_error_resume();
+	lf_test(context->packets == packets, "%u calls with invalid arguments were sent.", context->packets - packets);
+
+	struct _fmr_result results[1];
+	lf_test(lf_batch_commit(&batch, results) == lf_success && results[0].value == 1, "The batch lost the call added before the invalid one.");
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(9))) == 9, "A call after those with invalid arguments failed.");
+
+	printf("args: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/* batch.c - Checks that a batch returns the result of each of its invocations, in order, in a single exchange. */
+
+#include "device.h"
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+
+	/* Each invocation gets its own result, in the order it was added. */
+	struct _lf_batch batch;
+	struct _fmr_result results[FMR_MAX_BATCH];
+	lf_test(lf_batch_begin(&batch, device) == lf_success, "Failed to begin a batch.");
+	for (uint32_t i = 0; i < FMR_MAX_BATCH; i ++) {
+		lf_test(lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(100 + i))) == lf_success, "Failed to add invocation %u to the batch.", i);
+	}
+	lf_error_pause();
+	lf_test(lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(0))) == lf_error, "A batch took more than %i invocations.", FMR_MAX_BATCH);
+	lf_error_resume();
+	lf_error_clear();
+	uint32_t packets = context->packets, pushes = context->pushes;
+	lf_test(lf_batch_commit(&batch, results) == lf_success, "Failed to commit the batch.");
+	lf_test(context->packets == packets + 1 && context->pushes == pushes + 1, "A batch was sent as %u packets in %u transfers.", context->packets - packets, context->pushes - pushes);
+	for (uint32_t i = 0; i < FMR_MAX_BATCH; i ++) {
+		lf_test(results[i].value == 100 + i && results[i].error == E_OK, "Invocation %u of the batch returned %u rather than %u.", i, (uint32_t)results[i].value, 100 + i);
+	}
+
+	/* An invocation that fails reports its error in its own slot, and the others are unaffected. The committed batch is empty and can be reused. */
+	lf_test(lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(1))) == lf_success, "Failed to add to a committed batch.");
+	lf_test(lf_batch_add(&batch, &module, lf_test_fmr_fail_f, lf_uint32_t, lf_args(lf_uint32(E_OVERFLOW))) == lf_success, "Failed to add to the batch.");
+	lf_test(lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(3))) == lf_success, "Failed to add to the batch.");
+	lf_error_pause();
+	lf_test(lf_batch_commit(&batch, results) == lf_error, "A batch with a failed invocation succeeded.");
+	lf_error_resume();
+	lf_test(lf_error_get() == E_OVERFLOW, "A failed batch reported error %i.", lf_error_get());
+	lf_error_clear();
+	lf_test(results[0].value == 1 && results[0].error == E_OK, "The invocation before the failure returned %u with error %i.", (uint32_t)results[0].value, results[0].error);
+	lf_test(results[1].error == E_OVERFLOW, "The failed invocation reported error %i.", results[1].error);
+	lf_test(results[2].value == 3 && results[2].error == E_OK, "The invocation after the failure returned %u with error %i.", (uint32_t)results[2].value, results[2].error);
+
+	/* Nothing is left to be pulled, and the device goes on to answer invocations. */
+	lf_test(context->head == context->tail, "%u replies were left unpulled.", context->tail - context->head);
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(4))) == 4, "The invocation after a batch failed.");
+
+	/* A device that does not support batches refuses them. */
+	device->configuration.capabilities &= ~lf_capability_batch;
+	lf_error_pause();
+	lf_test(lf_batch_begin(&batch, device) == lf_error, "A batch was begun on a device that does not support them.");
+	lf_error_resume();
+	lf_error_clear();
+
+	printf("batch: ok\n");
+	return EXIT_SUCCESS;
+}
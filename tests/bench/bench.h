@@ -0,0 +1,30 @@
+/* bench.h - Timing shared by the benchmarks. Each benchmark is a program that prints what it measured. */
+
+#ifndef __lf_bench_h__
+#define __lf_bench_h__
+
+#include <flipper.h>
+#include <time.h>
+
+/* Returns a monotonic time in seconds. */
+static inline double lf_bench_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static inline int lf_bench_compare(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/* Sorts the samples and returns the one at the given percentile. */
+static inline double lf_bench_percentile(double *samples, size_t count, int percentile) {
+	qsort(samples, count, sizeof(double), lf_bench_compare);
+	return samples[count * percentile / 100];
+}
+
+/* Keeps the compiler from discarding a result that is otherwise unused. */
+#define lf_bench_use(_value) __asm__ __volatile__ ("" : : "r"(_value) : "memory")
+
+#endif
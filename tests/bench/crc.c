@@ -0,0 +1,39 @@
+/* crc.c - Measures the throughput of each CRC backend built for the host, across buffer sizes. */
+
+#include "bench.h"
+
+uint16_t calcrc(const char *ptr, uint32_t count);
+
+#define SIZE (1 << 20)
+/* The number of bytes checksummed per measurement. */
+#define TOTAL (1 << 24)
+
+/* Returns the throughput of the CRC in GB/s. */
+double measure(lf_crc_t (* crc)(const void *source, size_t length), const void *source, size_t length) {
+	size_t repetitions = TOTAL / length;
+	double start = lf_bench_now();
+	for (size_t i = 0; i < repetitions; i ++) lf_bench_use(crc(source, length));
+	return length * repetitions / (lf_bench_now() - start) / 1e9;
+}
+
+lf_crc_t bitwise(const void *source, size_t length) {
+	return calcrc(source, length);
+}
+
+lf_crc_t tables(const void *source, size_t length) {
+	return lf_crc_update(0, source, length);
+}
+
+int main(void) {
+	uint8_t *data = malloc(SIZE);
+	for (size_t i = 0; i < SIZE; i ++) data[i] = rand();
+	printf("%8s  %10s  %10s  %10s\n", "bytes", "bitwise", "tables", "lf_crc");
+	/* The lengths grow eightfold. The last is clamped so that the whole buffer is measured. */
+	for (size_t length = 8; ; length *= 8) {
+		if (length > SIZE) length = SIZE;
+		printf("%8zu  %5.2f GB/s  %5.2f GB/s  %5.2f GB/s\n", length, measure(bitwise, data, length), measure(tables, data, length), measure(lf_crc, data, length));
+		if (length == SIZE) break;
+	}
+	free(data);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/* dispatch.c - Measures the cost of calling a function through the message runtime, compared with calling it directly. */
+
+#include "bench.h"
+
+#define CALLS 20000000
+
+__attribute__((noinline)) uint32_t add2(uint32_t a, uint32_t b) {
+	return a + b;
+}
+
+__attribute__((noinline)) uint32_t add6(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e, uint32_t f) {
+	return a + b + c + d + e + f;
+}
+
+__attribute__((noinline)) uint32_t add8(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e, uint32_t f, uint32_t g, uint32_t h) {
+	return a + b + c + d + e + f + g + h;
+}
+
+/* Returns the time per call through the message runtime, in nanoseconds. */
+double measure(void (* function)(void), struct _fmr_args *args) {
+	double start = lf_bench_now();
+	for (int i = 0; i < CALLS; i ++) lf_bench_use(fmr_call((lf_return_t (*)(void))function, lf_uint32_t, args->argc, args->types, args->values));
+	return (lf_bench_now() - start) / CALLS * 1e9;
+}
+
+int main(void) {
+	double start = lf_bench_now();
+	for (int i = 0; i < CALLS; i ++) lf_bench_use(add2(i, 2));
+	double direct = (lf_bench_now() - start) / CALLS * 1e9;
+	printf("direct, 2 arguments: %6.2f ns/call\n", direct);
+	printf("fmr_call, 2 arguments: %6.2f ns/call\n", measure((void (*)(void))add2, lf_args(lf_uint32(1), lf_uint32(2))));
+	printf("fmr_call, 6 arguments: %6.2f ns/call\n", measure((void (*)(void))add6, lf_args(lf_uint32(1), lf_uint32(2), lf_uint32(3), lf_uint32(4), lf_uint32(5), lf_uint32(6))));
+	printf("fmr_call, 8 arguments: %6.2f ns/call\n", measure((void (*)(void))add8, lf_args(lf_uint32(1), lf_uint32(2), lf_uint32(3), lf_uint32(4), lf_uint32(5), lf_uint32(6), lf_uint32(7), lf_uint32(8))));
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/* events.c - Compares finding a registered event through the table with walking a list of the events, as the runtime used to. */
+
+#include "bench.h"
+
+#define LOOKUPS 200000
+
+int main(void) {
+	printf("%6s  %12s  %10s  %10s\n", "events", "register", "list walk", "table");
+	for (int count = 8; count <= 4096; count *= 8) {
+		lf_event **events = malloc(count * sizeof(lf_event *));
+		struct _lf_ll *list = NULL;
+
+		double start = lf_bench_now();
+		for (int i = 0; i < count; i ++) events[i] = lf_event_register(lf_event_generate_unique_id(), NULL, NULL);
+		double registration = (lf_bench_now() - start) / count;
+		for (int i = 0; i < count; i ++) lf_ll_append(&list, events[i], NULL);
+
+		/* Looks events up in a scattered order. The list is walked fewer times as it grows. */
+		start = lf_bench_now();
+		for (int r = 0; r < LOOKUPS; r ++) lf_bench_use(lf_event_for_id(events[(r * 7919) % count]->id));
+		double table = (lf_bench_now() - start) / LOOKUPS;
+		int walks = LOOKUPS / (count / 8 + 1);
+		start = lf_bench_now();
+		for (int r = 0; r < walks; r ++) {
+			lf_event_id id = events[(r * 7919) % count]->id;
+			for (struct _lf_ll *node = list; node; node = node->next) {
+				if (((lf_event *)node->item)->id == id) {
+					lf_bench_use(node->item);
+					break;
+				}
+			}
+		}
+		double walk = (lf_bench_now() - start) / walks;
+
+		printf("%6i  %9.0f ns  %7.0f ns  %7.0f ns\n", count, registration * 1e9, walk * 1e9, table * 1e9);
+
+		for (int i = 0; i < count; i ++) lf_event_unregister(events[i]);
+		lf_ll_release(&list);
+		free(events);
+	}
+	return EXIT_SUCCESS;
+}
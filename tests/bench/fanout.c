@@ -0,0 +1,126 @@
+/* fanout.c - Compares calling every attached device in turn with calling them all at once through lf_invoke_all and lf_push_all. */
+
+#include "bench.h"
+
+#define ROUNDS 20
+#define MAX_DEVICES 8
+
+/* The most results a board holds before they are pulled. */
+#define BOARD_RESULTS 16
+
+/* A board answered within the benchmark. Invocations return their first parameter, and data pushed after a push packet is taken as is. */
+struct _board_context {
+	struct _fmr_result results[BOARD_RESULTS];
+	uint32_t head, tail;
+};
+
+int board_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _board_context *context = endpoint->_ctx;
+	struct _fmr_packet *packet = source;
+	/* Anything that is not a packet is the data of a push, whose result was queued with its packet. */
+	if (length < sizeof(struct _fmr_header) || packet->header.magic != FMR_MAGIC_NUMBER) return lf_success;
+	if (packet->header.flags & FMR_FLAG_NO_REPLY) return lf_success;
+	if (context->tail - context->head == BOARD_RESULTS) return lf_error;
+	struct _fmr_result *result = &context->results[context->tail ++ % BOARD_RESULTS];
+	memset(result, 0, sizeof(struct _fmr_result));
+	result->sequence = packet->header.sequence;
+	if (packet->header.type == fmr_standard_invocation_class || packet->header.type == fmr_user_invocation_class) {
+		struct _fmr_invocation *call = &((struct _fmr_invocation_packet *)packet)->call;
+		uint32_t value = 0;
+		if (call->argc) memcpy(&value, call->parameters, sizeof(uint32_t));
+		result->value = value;
+	} else if (packet->header.type != fmr_push_class && packet->header.type != fmr_sync_class) {
+		/* Answer every other packet as firmware that does not know it would. */
+		result->error = E_SUBCLASS;
+	}
+	return lf_success;
+}
+
+int board_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _board_context *context = endpoint->_ctx;
+	if (context->head == context->tail || length != sizeof(struct _fmr_result)) return lf_error;
+	memcpy(destination, &context->results[context->head ++ % BOARD_RESULTS], sizeof(struct _fmr_result));
+	return lf_success;
+}
+
+/* Attaches another board, slowed down to the link described by the environment. */
+struct _lf_device *board_attach(void) {
+	struct _lf_endpoint *endpoint = lf_endpoint_create(NULL, NULL, board_push, board_pull, NULL, sizeof(struct _board_context));
+	if (!endpoint) return NULL;
+	struct _lf_device *device = lf_device_create(endpoint, NULL, NULL, 0);
+	if (!device) return NULL;
+	strcpy(device->configuration.name, "board");
+	if (lf_attach(device) != lf_success) return NULL;
+	lf_error_clear();
+	return device;
+}
+
+int main(void) {
+	/* Each board sits behind the link of a Carbon, unless another link is described. */
+	setenv(LF_LINK_ENV, "carbon", 0);
+	printf("link: %s\n", getenv(LF_LINK_ENV));
+
+	/* A module that is not bound to a device is invoked on whichever device the thread has selected. */
+	struct _lf_module module;
+	memset(&module, 0, sizeof(struct _lf_module));
+	module.name = "board";
+
+	struct _lf_device *boards[MAX_DEVICES];
+	struct _lf_device *devices[MAX_DEVICES];
+	struct _fmr_result results[MAX_DEVICES];
+	uint8_t data[64];
+	for (size_t i = 0; i < sizeof(data); i ++) data[i] = i;
+
+	printf("%7s  %10s  %10s  %10s  %10s  %6s\n", "devices", "invoke", "invoke_all", "push", "push_all", "failed");
+	int attached = 0;
+	for (int count = 1; count <= MAX_DEVICES; count *= 2) {
+		while (attached < count) {
+			boards[attached] = board_attach();
+			if (!boards[attached]) {
+				fprintf(stderr, "Failed to attach a board.\n");
+				return EXIT_FAILURE;
+			}
+			attached ++;
+		}
+		int failed = 0;
+
+		double start = lf_bench_now();
+		for (int r = 0; r < ROUNDS; r ++) {
+			for (int i = 0; i < count; i ++) {
+				lf_select(boards[i]);
+				if (lf_invoke(&module, 0, lf_uint32_t, lf_args(lf_uint32(r))) != (lf_return_t)r) failed ++;
+			}
+		}
+		double invoke = lf_bench_now() - start;
+
+		start = lf_bench_now();
+		for (int r = 0; r < ROUNDS; r ++) {
+			int found = lf_invoke_all(&module, 0, lf_uint32_t, lf_args(lf_uint32(r)), devices, results, MAX_DEVICES);
+			if (found != count) failed ++;
+			for (int i = 0; i < found; i ++) if (results[i].error || results[i].value != (lf_return_t)r) failed ++;
+		}
+		double invoke_all = lf_bench_now() - start;
+
+		start = lf_bench_now();
+		for (int r = 0; r < ROUNDS; r ++) {
+			for (int i = 0; i < count; i ++) {
+				lf_select(boards[i]);
+				if (lf_push(&module, 0, data, sizeof(data), NULL) != lf_success) failed ++;
+			}
+		}
+		double push = lf_bench_now() - start;
+
+		start = lf_bench_now();
+		for (int r = 0; r < ROUNDS; r ++) {
+			int found = lf_push_all(&module, 0, data, sizeof(data), NULL, devices, results, MAX_DEVICES);
+			if (found != count) failed ++;
+			for (int i = 0; i < found; i ++) if (results[i].error) failed ++;
+		}
+		double push_all = lf_bench_now() - start;
+
+		printf("%7i  %7.2f ms  %7.2f ms  %7.2f ms  %7.2f ms  %6i\n", count, invoke / ROUNDS * 1e3, invoke_all / ROUNDS * 1e3, push / ROUNDS * 1e3, push_all / ROUNDS * 1e3, failed);
+	}
+
+	for (int i = 0; i < attached; i ++) lf_detach(boards[i]);
+	return EXIT_SUCCESS;
+}
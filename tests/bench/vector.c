@@ -0,0 +1,89 @@
+/* vector.c - Compares vectors with the linked lists they replaced, for the ways the runtime uses its lists. */
+
+#include "bench.h"
+
+/* The number of items visited per measurement. */
+#define TOTAL 2000000
+
+struct app {
+	char name[16];
+};
+
+int main(void) {
+	printf("%5s  %-21s  %-21s  %-21s  %-21s\n", "items", "lookup by name", "walk", "remove and append", "append all");
+	for (int count = 4; count <= 256; count *= 4) {
+		int repetitions = TOTAL / count;
+		struct app *apps = malloc(count * sizeof(struct app));
+		for (int i = 0; i < count; i ++) snprintf(apps[i].name, sizeof(apps[i].name), "app%i", i);
+		const char *name = apps[count - 1].name;
+		struct _lf_ll *list = NULL;
+		struct _lf_vector vector = LF_VECTOR(NULL);
+
+		double start = lf_bench_now();
+		for (int i = 0; i < count; i ++) lf_ll_append(&list, &apps[i], NULL);
+		double list_append = lf_bench_now() - start;
+		start = lf_bench_now();
+		for (int i = 0; i < count; i ++) lf_vector_append(&vector, &apps[i]);
+		double vector_append = lf_bench_now() - start;
+
+		/* Finds the last item by name, as the loader looks up applications. Indexing a list walks it, so fewer lookups are timed. */
+		int lookups = repetitions / count + 1;
+		start = lf_bench_now();
+		for (int r = 0; r < lookups; r ++) {
+			int found = lf_ll_count(list);
+			for (int i = 0; i < found; i ++) {
+				struct app *app = lf_ll_item(list, i);
+				if (!strcmp(app->name, name)) {
+					lf_bench_use(app);
+					break;
+				}
+			}
+		}
+		double list_lookup = (lf_bench_now() - start) / lookups;
+		start = lf_bench_now();
+		for (int r = 0; r < repetitions; r ++) {
+			for (uint32_t i = 0; i < lf_vector_count(&vector); i ++) {
+				struct app *app = lf_vector_item(&vector, i);
+				if (!strcmp(app->name, name)) {
+					lf_bench_use(app);
+					break;
+				}
+			}
+		}
+		double vector_lookup = (lf_bench_now() - start) / repetitions;
+
+		/* Visits every item, as events are applied to their observers. */
+		start = lf_bench_now();
+		for (int r = 0; r < repetitions; r ++) {
+			for (struct _lf_ll *node = list; node; node = node->next) lf_bench_use(node->item);
+		}
+		double list_walk = (lf_bench_now() - start) / repetitions;
+		start = lf_bench_now();
+		for (int r = 0; r < repetitions; r ++) {
+			for (uint32_t i = 0; i < vector.count; i ++) lf_bench_use(vector.items[i]);
+		}
+		double vector_walk = (lf_bench_now() - start) / repetitions;
+
+		/* Removes and appends an item in the middle, as devices detach and attach. */
+		int changes = repetitions / 10;
+		start = lf_bench_now();
+		for (int r = 0; r < changes; r ++) {
+			lf_ll_remove(&list, &apps[count / 2]);
+			lf_ll_append(&list, &apps[count / 2], NULL);
+		}
+		double list_change = (lf_bench_now() - start) / changes;
+		start = lf_bench_now();
+		for (int r = 0; r < changes; r ++) {
+			lf_vector_remove(&vector, &apps[count / 2]);
+			lf_vector_append(&vector, &apps[count / 2]);
+		}
+		double vector_change = (lf_bench_now() - start) / changes;
+
+		printf("%5i  %7.0f -> %7.0f ns  %7.1f -> %7.1f ns  %7.0f -> %7.0f ns  %7.2f -> %7.2f us\n", count, list_lookup * 1e9, vector_lookup * 1e9, list_walk * 1e9, vector_walk * 1e9, list_change * 1e9, vector_change * 1e9, list_append * 1e6, vector_append * 1e6);
+
+		lf_ll_release(&list);
+		lf_vector_release(&vector);
+		free(apps);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,57 @@
+/* completion.c - Checks that a result that fails to arrive does not wedge the device it was expected from. */
+
+#include "test.h"
+
+lf_return_t invoke(struct _lf_module *module, uint32_t value) {
+	return lf_invoke(module, 0, lf_uint32_t, lf_args(lf_uint32(value)));
+}
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_device_create("completion", &module);
+	struct _lf_test_context *context = lf_test_context(device);
+
+	lf_test(invoke(&module, 1) == 1, "The first invocation failed.");
+
+	/* A result that is lost fails its own invocation, and no other. */
+	context->failures = 1;
+	context->lose = true;
+	lf_test(invoke(&module, 2) == (lf_return_t)-1, "An invocation whose result was lost succeeded.");
+	lf_test(lf_error_get() == E_ENDPOINT, "A lost result was reported as error %i.", lf_error_get());
+	lf_test(device->outstanding == 0, "%i invocations are still outstanding after a lost result.", device->outstanding);
+	lf_error_clear();
+	lf_test(invoke(&module, 3) == 3, "The invocation after a lost result failed.");
+
+	/* A result that arrives after its invocation was abandoned is skipped. */
+	context->failures = 1;
+	context->lose = false;
+	lf_test(invoke(&module, 4) == (lf_return_t)-1, "An invocation whose result was late succeeded.");
+	lf_error_clear();
+	lf_test(invoke(&module, 5) == 5, "The invocation after a late result failed.");
+
+	/* A failure abandons every outstanding invocation, so that the next one and a drain do not wait on them. */
+	lf_test(lf_set_window(device, 4) == lf_success, "Failed to widen the window.");
+	struct _lf_completion *completions[4];
+	for (int i = 0; i < 4; i ++) {
+		completions[i] = lf_invoke_async(&module, 0, lf_uint32_t, lf_args(lf_uint32(10 + i)));
+		lf_test(completions[i], "Failed to send invocation %i.", i);
+	}
+	context->failures = 1;
+	context->lose = true;
+	lf_test(lf_await(completions[0]) == (lf_return_t)-1, "An invocation whose result was lost succeeded.");
+	for (int i = 1; i < 4; i ++) {
+		lf_test(lf_await(completions[i]) == (lf_return_t)-1, "Invocation %i was not abandoned.", i);
+	}
+	lf_error_clear();
+	lf_test(lf_drain(device) == lf_success, "Failed to drain the device after its invocations were abandoned.");
+	lf_test(invoke(&module, 20) == 20, "The invocation after abandoned invocations failed.");
+
+	/* Every completion is free again. */
+	for (int i = 0; i < LF_MAX_OUTSTANDING; i ++) {
+		lf_test(device->completions[i].state == lf_completion_free, "Completion %i was not freed.", i);
+	}
+
+	lf_device_release(device);
+	printf("completion: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/* configuration.c - Checks that the protocol is negotiated from the configuration a device reports, and that firmware that reports none falls back to the defaults. */
+
+#include "device.h"
+
+/* Creates a device reporting the given frame size and window, and loads its configuration. */
+struct _lf_device *configure(struct _lf_module *module, bool legacy, uint16_t frame_size, uint8_t window) {
+	fmr_configuration.frame_size = frame_size;
+	fmr_configuration.window = window;
+	struct _lf_device *device = lf_test_fmr_create(module);
+	lf_test_fmr_context(device)->legacy = legacy;
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+	lf_test(lf_test_fmr_context(device)->head == lf_test_fmr_context(device)->tail, "Part of the configuration was left unpulled.");
+	return device;
+}
+
+int main(void) {
+	struct _lf_module module;
+	uint8_t data[FMR_INLINE_SIZE];
+	memset(data, 1, sizeof(data));
+
+	/* Firmware that predates the configuration packet answers with a bare result. Every protocol feature is left off. */
+	struct _lf_device *device = configure(&module, true, FMR_MAX_PACKET_SIZE, LF_MAX_OUTSTANDING);
+	lf_test(device->frame_size == FMR_PACKET_SIZE, "A legacy device was given frames of %u bytes.", device->frame_size);
+	lf_test(device->window == 1, "A legacy device was given a window of %u.", device->window);
+	lf_test(device->configuration.capabilities == 0, "A legacy device was given capabilities %#x.", device->configuration.capabilities);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	uint32_t pushes = context->pushes;
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, sizeof(data), NULL) == sizeof(data), "Failed to push to a legacy device.");
+	lf_test(context->pushes == pushes + 2 && context->largest <= FMR_PACKET_SIZE, "A push to a legacy device was sent inline.");
+	struct _lf_batch batch;
+	lf_error_pause();
+	lf_test(lf_batch_begin(&batch, device) == lf_error, "A batch was begun on a legacy device.");
+	lf_test(lf_set_deferred(device, true) == lf_error, "Invocations were deferred on a legacy device.");
+	lf_error_resume();
+	lf_error_clear();
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(1))) == 1, "Failed to invoke a legacy device.");
+
+	/* A device that reports its configuration is given the largest frames and the widest window that both sides support. */
+	device = configure(&module, false, FMR_MAX_PACKET_SIZE, 4);
+	lf_test(device->frame_size == FMR_MAX_PACKET_SIZE, "A device accepting frames of %u bytes was given frames of %u.", FMR_MAX_PACKET_SIZE, device->frame_size);
+	lf_test(device->window == 4, "A device accepting a window of 4 was given a window of %u.", device->window);
+	lf_test(device->configuration.capabilities == fmr_configuration.capabilities, "The device was given capabilities %#x rather than %#x.", device->configuration.capabilities, fmr_configuration.capabilities);
+	lf_test(!strcmp(device->configuration.name, "test") && device->configuration.version == LF_VERSION, "The configuration was not read whole.");
+	context = lf_test_fmr_context(device);
+	pushes = context->pushes;
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, sizeof(data), NULL) == sizeof(data), "Failed to push to a configured device.");
+	lf_test(context->pushes == pushes + 1, "A push to a device that supports inline data was sent separately.");
+
+	/* Limits beyond what the host supports are brought within them. */
+	device = configure(&module, false, FMR_MAX_PACKET_SIZE * 4, 255);
+	lf_test(device->frame_size == FMR_MAX_PACKET_SIZE && device->window == LF_MAX_OUTSTANDING, "A device reporting larger limits was given frames of %u bytes and a window of %u.", device->frame_size, device->window);
+	device = configure(&module, false, FMR_PACKET_SIZE / 2, 0);
+	lf_test(device->frame_size == FMR_PACKET_SIZE && device->window == 1, "A device reporting smaller limits was given frames of %u bytes and a window of %u.", device->frame_size, device->window);
+
+	/* A configuration without a frame size is not trusted. */
+	device = configure(&module, false, 0, 4);
+	lf_test(device->frame_size == FMR_PACKET_SIZE && device->window == 1 && device->configuration.capabilities == 0, "A configuration without a frame size was used.");
+
+	printf("configuration: ok\n");
+	return EXIT_SUCCESS;
+}
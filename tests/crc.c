@@ -0,0 +1,54 @@
+/* crc.c - Checks every CRC backend built for the host against the bitwise CRC that devices compute. */
+
+#include "test.h"
+
+/* The reference CRC, shifted one bit at a time. */
+uint16_t calcrc(const char *ptr, uint32_t count);
+#if defined(__x86_64__)
+lf_crc_t lf_crc_clmul(const void *source, size_t length);
+#endif
+
+#define SIZE (1 << 20)
+
+int main(void) {
+	/* The check value of CRC-16/XMODEM, which is the CCITT polynomial with a zero seed. */
+	lf_test(lf_crc("123456789", 9) == 0x31c3, "The CRC of the check string is %04x.", lf_crc("123456789", 9));
+	lf_test(calcrc("123456789", 9) == 0x31c3, "The reference CRC of the check string is %04x.", calcrc("123456789", 9));
+
+	/* Every length up to a few kilobytes, at each alignment, covers the ends of each backend's blocks. */
+	uint8_t *data = malloc(SIZE + 8);
+	lf_test(data, "Failed to allocate the data.");
+	srand(1);
+	for (size_t i = 0; i < SIZE + 8; i ++) data[i] = rand();
+#if defined(__x86_64__)
+	bool clmul = __builtin_cpu_supports("pclmul");
+#endif
+	for (size_t length = 0; length < 2048; length ++) {
+		for (int offset = 0; offset < 4; offset ++) {
+			uint8_t *source = data + offset;
+			lf_crc_t expected = calcrc((char *)source, length);
+			lf_test(lf_crc_update(0, source, length) == expected, "The tables disagree for %zu bytes at offset %i.", length, offset);
+			lf_test(lf_crc(source, length) == expected, "lf_crc disagrees for %zu bytes at offset %i.", length, offset);
+#if defined(__x86_64__)
+			if (clmul && length >= 16) {
+				lf_test(lf_crc_clmul(source, length) == expected, "The folded CRC disagrees for %zu bytes at offset %i.", length, offset);
+			}
+#endif
+		}
+	}
+
+	/* A CRC continued across pieces matches the CRC of the whole. */
+	lf_crc_t crc = lf_crc_update(0, data, 1000);
+	crc = lf_crc_update(crc, data + 1000, 3);
+	crc = lf_crc_update(crc, data + 1003, 997);
+	lf_test(crc == calcrc((char *)data, 2000), "A continued CRC disagrees.");
+
+	/* Large buffers keep folding through many blocks. */
+	for (size_t length = 1 << 12; length <= SIZE; length = length * 2 + 77) {
+		lf_test(lf_crc(data, length) == calcrc((char *)data, length), "lf_crc disagrees for %zu bytes.", length);
+	}
+
+	free(data);
+	printf("crc: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+/* deferred.c - Checks that invocations returning nothing are sent without a reply when deferred, and that their failures are reported by the next sync. */
+
+#include "device.h"
+
+void defer(struct _lf_module *module, lf_error_t error) {
+	lf_invoke(module, lf_test_fmr_raise_f, lf_void_t, lf_args(lf_uint32(error)));
+}
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+
+	/* Deferring needs the device to support it, which only its configuration says. */
+	lf_error_pause();
+	lf_test(lf_set_deferred(device, true) == lf_error && lf_error_get() == E_CONFIGURATION, "Invocations were deferred on a device that was not configured.");
+	lf_error_resume();
+	lf_error_clear();
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+	lf_test(lf_set_deferred(device, true) == lf_success, "Failed to defer invocations.");
+
+	/* A deferred invocation is performed at once, but no reply is sent for it. */
+	uint32_t packets = context->packets, pulls = context->pulls;
+	defer(&module, E_OK);
+	lf_test(lf_error_get() == E_OK, "A deferred invocation failed.");
+	lf_test(context->packets == packets + 1 && context->pulls == pulls && context->head == context->tail, "A deferred invocation was replied to.");
+
+	/* Invocations that return a value are still waited on, after the deferred ones before them. */
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(5))) == 5, "An invocation after a deferred one failed.");
+
+	/* A deferred failure is not reported by its invocation, nor by those after it, but by the sync. */
+	defer(&module, E_OVERFLOW);
+	lf_test(lf_error_get() == E_OK, "A deferred failure was reported by its invocation.");
+	defer(&module, E_OK);
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(6))) == 6, "An invocation after a deferred failure failed.");
+	lf_error_pause();
+	lf_test(lf_sync(device) == lf_error && lf_error_get() == E_OVERFLOW, "A sync reported error %i rather than the deferred failure.", lf_error_get());
+	lf_error_resume();
+	lf_error_clear();
+	lf_test(lf_sync(device) == lf_success, "A deferred failure was reported by two syncs.");
+	lf_test(device->unsynced == 0, "%u invocations are unsynced after a sync.", device->unsynced);
+
+	/* The device is synced before too many invocations go without a reply. */
+	for (int i = 0; i < LF_MAX_UNSYNCED * 2; i ++) {
+		defer(&module, E_OK);
+		lf_test(device->unsynced <= LF_MAX_UNSYNCED, "%u invocations were sent without a reply.", device->unsynced);
+	}
+
+	/* Turning deferral off reports what is outstanding. */
+	defer(&module, E_OVERFLOW);
+	lf_error_pause();
+	lf_test(lf_set_deferred(device, false) == lf_error && lf_error_get() == E_OVERFLOW, "Turning deferral off did not report the deferred failure.");
+	lf_error_resume();
+	lf_error_clear();
+	pulls = context->pulls;
+	defer(&module, E_OK);
+	lf_test(context->pulls == pulls + 1, "An invocation that is no longer deferred was not replied to.");
+	lf_test(context->head == context->tail, "%u replies were left unpulled.", context->tail - context->head);
+
+	printf("deferred: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,197 @@
+/* device.h - A device within the test that performs packets through the message runtime, as firmware and fvm do. Its replies are queued until they are pulled. */
+
+#ifndef __lf_device_h__
+#define __lf_device_h__
+
+#include "test.h"
+
+/* The most replies the device holds before they are pulled, and the largest reply or push it takes. */
+#define LF_TEST_FMR_MAX_REPLIES 32
+#define LF_TEST_FMR_DATA_SIZE 4096
+
+struct _lf_test_fmr_reply {
+	uint8_t data[LF_TEST_FMR_DATA_SIZE];
+	lf_size_t length;
+};
+
+struct _lf_test_fmr_context {
+	/* The replies that have been sent but not yet pulled, oldest first. */
+	struct _lf_test_fmr_reply replies[LF_TEST_FMR_MAX_REPLIES];
+	uint32_t head, tail;
+	/* The packet being performed, or a push or load whose data has yet to arrive. */
+	struct _fmr_packet waiting;
+	bool data_follows;
+	/* The data of the push being performed, and the data stored by the module. */
+	uint8_t *incoming;
+	uint8_t stored[LF_TEST_FMR_DATA_SIZE];
+	lf_size_t stored_length;
+	/* If set, the configuration is not reported, as firmware that predates it. */
+	bool legacy;
+	/* The number of pulls to fail. The replies they would have returned arrive late, on the pulls after. */
+	int failures;
+	/* The number of packets performed, transfers pushed and replies pulled, and the largest packet performed. */
+	uint32_t packets, pushes, pulls;
+	lf_size_t largest;
+};
+
+/* The device whose packet is being performed. */
+struct _lf_test_fmr_context *lf_test_fmr_performing;
+
+/* The functions of the only standard module the device has, at index 0. */
+enum { lf_test_fmr_echo_f, lf_test_fmr_fail_f, lf_test_fmr_raise_f, lf_test_fmr_store_f, lf_test_fmr_load_f };
+
+uint32_t lf_test_fmr_echo(uint32_t value) {
+	return value;
+}
+
+uint32_t lf_test_fmr_fail(uint32_t error) {
+	lf_error_raise(error, NULL);
+	return -1;
+}
+
+/* Returns nothing, so that it can be invoked without a reply. */
+void lf_test_fmr_raise(uint32_t error) {
+	if (error) lf_error_raise(error, NULL);
+}
+
+/* Keeps the data pushed, and returns the sum of its bytes. */
+uint32_t lf_test_fmr_store(void *source, uint32_t length) {
+	struct _lf_test_fmr_context *context = lf_test_fmr_performing;
+	memcpy(context->stored, source, length);
+	context->stored_length = length;
+	uint32_t sum = 0;
+	for (uint32_t i = 0; i < length; i ++) sum += ((uint8_t *)source)[i];
+	return sum;
+}
+
+/* Returns the data last pushed, and its length. */
+uint32_t lf_test_fmr_load(void *destination, uint32_t length) {
+	struct _lf_test_fmr_context *context = lf_test_fmr_performing;
+	memcpy(destination, context->stored, length);
+	return context->stored_length;
+}
+
+void *const lf_test_fmr_functions[] = { (void *)lf_test_fmr_echo, (void *)lf_test_fmr_fail, (void *)lf_test_fmr_raise, (void *)lf_test_fmr_store, (void *)lf_test_fmr_load };
+
+/* Take the place of the standard modules and the configuration of the host library, as fvm's do. */
+const void *const lf_modules[] = { lf_test_fmr_functions };
+
+struct _lf_configuration fmr_configuration = {
+	"test",
+	0,
+	LF_VERSION,
+	lf_device_32bit | lf_device_little_endian,
+	FMR_MAX_PACKET_SIZE,
+	LF_MAX_OUTSTANDING,
+	lf_capability_batch | lf_capability_inline | lf_capability_deferred,
+	0
+};
+
+/* Queues a reply to be pulled by the host. */
+static inline void lf_test_fmr_send(struct _lf_test_fmr_context *context, void *source, lf_size_t length) {
+	lf_test(context->tail - context->head < LF_TEST_FMR_MAX_REPLIES && length <= LF_TEST_FMR_DATA_SIZE, "The device cannot hold another reply.");
+	struct _lf_test_fmr_reply *reply = &context->replies[context->tail ++ % LF_TEST_FMR_MAX_REPLIES];
+	memcpy(reply->data, source, length);
+	reply->length = length;
+}
+
+lf_return_t fmr_push(struct _fmr_push_pull_packet *packet) {
+	*(uint64_t *)(packet->call.parameters) = (uintptr_t)lf_test_fmr_performing->incoming;
+	return fmr_execute(packet->call.index, packet->call.function, packet->call.ret, packet->call.argc, packet->call.types, (void *)(packet->call.parameters));
+}
+
+lf_return_t fmr_pull(struct _fmr_push_pull_packet *packet) {
+	static uint8_t swap[LF_TEST_FMR_DATA_SIZE];
+	*(uint64_t *)(packet->call.parameters) = (uintptr_t)swap;
+	lf_return_t value = fmr_execute(packet->call.index, packet->call.function, packet->call.ret, packet->call.argc, packet->call.types, (void *)(packet->call.parameters));
+	lf_test_fmr_send(lf_test_fmr_performing, swap, packet->length);
+	return value;
+}
+
+lf_return_t fmr_batch(struct _fmr_batch_packet *packet) {
+	struct _fmr_result results[FMR_MAX_BATCH];
+	memset(results, 0, sizeof(results));
+	int performed = fmr_execute_batch(packet, results);
+	/* The host always expects one result per invocation in the batch. */
+	lf_test_fmr_send(lf_test_fmr_performing, results, packet->count * sizeof(struct _fmr_result));
+	return performed;
+}
+
+/* Performs a packet, queueing its replies as fvm sends them. */
+static inline void lf_test_fmr_perform(struct _lf_test_fmr_context *context, struct _fmr_packet *packet) {
+	context->packets ++;
+	if (packet->header.length > context->largest) context->largest = packet->header.length;
+	struct _fmr_reply reply;
+	lf_test_fmr_performing = context;
+	lf_error_clear();
+	lf_size_t size = fmr_perform(packet, &reply);
+	/* The device's errors are its own, so they do not leak into the host's. */
+	lf_error_clear();
+	if (context->legacy && packet->header.type == fmr_configuration_class) {
+		reply.result.value = 0;
+		size = sizeof(struct _fmr_result);
+	}
+	if (packet->header.type == fmr_configuration_class && size > sizeof(struct _fmr_result)) {
+		lf_test_fmr_send(context, &reply.result, sizeof(struct _fmr_result));
+		lf_test_fmr_send(context, reply.data, size - sizeof(struct _fmr_result));
+	} else if (size) {
+		lf_test_fmr_send(context, &reply, size);
+	}
+}
+
+static inline int lf_test_fmr_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_test_fmr_context *context = endpoint->_ctx;
+	context->pushes ++;
+	/* The data of a push or load follows its packet in a transfer of its own. */
+	if (context->data_follows) {
+		context->data_follows = false;
+		context->incoming = source;
+		lf_test_fmr_perform(context, &context->waiting);
+		return lf_success;
+	}
+	/* The device works on its own copy of the packet, as one across a real link would. */
+	struct _fmr_packet *packet = &context->waiting;
+	lf_test(length == ((struct _fmr_header *)source)->length && length <= sizeof(struct _fmr_packet), "A frame of %u bytes was sent for a packet of %u.", length, ((struct _fmr_header *)source)->length);
+	memcpy(packet, source, length);
+	if (packet->header.type == fmr_push_class || packet->header.type == fmr_ram_load_class) {
+		context->data_follows = true;
+		return lf_success;
+	}
+	lf_test_fmr_perform(context, packet);
+	return lf_success;
+}
+
+static inline int lf_test_fmr_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_test_fmr_context *context = endpoint->_ctx;
+	/* A pull with nothing to return times out at once, rather than blocking the test. */
+	if (context->head == context->tail) return lf_error;
+	if (context->failures) {
+		context->failures --;
+		return lf_error;
+	}
+	/* Each reply is pulled whole, and truncated if it is longer than asked for, as a datagram would be. */
+	struct _lf_test_fmr_reply *reply = &context->replies[context->head ++ % LF_TEST_FMR_MAX_REPLIES];
+	memcpy(destination, reply->data, (reply->length < length) ? reply->length : length);
+	context->pulls ++;
+	return lf_success;
+}
+
+/* Creates a device that performs packets through the message runtime, and a module bound to it whose functions are those above. The configuration is not loaded. */
+static inline struct _lf_device *lf_test_fmr_create(struct _lf_module *module) {
+	struct _lf_endpoint *endpoint = lf_endpoint_create(NULL, NULL, lf_test_fmr_push, lf_test_fmr_pull, NULL, sizeof(struct _lf_test_fmr_context));
+	lf_test(endpoint, "Failed to create the test endpoint.");
+	struct _lf_device *device = lf_device_create(endpoint, NULL, NULL, 0);
+	lf_test(device, "Failed to create the test device.");
+	strcpy(device->configuration.name, "test");
+	memset(module, 0, sizeof(struct _lf_module));
+	module->name = "test";
+	module->index = 0;
+	module->device = device;
+	return device;
+}
+
+static inline struct _lf_test_fmr_context *lf_test_fmr_context(struct _lf_device *device) {
+	return device->endpoint->_ctx;
+}
+
+#endif
@@ -0,0 +1,68 @@
+/* dispatch.c - Checks that calls made through the message runtime receive their arguments and return their values as direct calls do. */
+
+#include "test.h"
+
+/* Mixes widths, signedness and a pointer, with more arguments than are passed in registers. */
+uint32_t mixed(uint8_t a, int16_t b, uint32_t c, uint64_t d, int8_t e, void *p, uint32_t g, uint64_t h) {
+	return a + b + c + (uint32_t)(d >> 32) + e + (p ? 1000 : 0) + g * 3 + (uint32_t)h;
+}
+
+int8_t negate(int8_t x) {
+	return -x;
+}
+
+uint32_t upper(uint64_t x) {
+	return x >> 32;
+}
+
+/* Returns nothing, so whatever is left in the return register must not be returned. */
+void nothing(uint32_t x) {
+	__asm__ __volatile__ ("" : : "r"(x));
+}
+
+/* Returns the position of the argument that is set, so that each argument's slot is told apart. */
+uint32_t position(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e, uint32_t f, uint32_t g, uint32_t h) {
+	uint32_t arguments[] = { a, b, c, d, e, f, g, h };
+	uint32_t found = 0;
+	for (uint32_t i = 0; i < 8; i ++) if (arguments[i]) found = found * 10 + i + 1;
+	return found;
+}
+
+#define call(function, ret, args) fmr_call((lf_return_t (*)(void))(void (*)(void))(function), ret, (args)->argc, (args)->types, (args)->values)
+
+int main(void) {
+	int local;
+	struct _fmr_args *args = lf_args(lf_uint8(200), lf_int16(-5), lf_uint32(7), lf_intx(lf_uint64_t, 0x500000000ULL), lf_int8(-3), lf_ptr(&local), lf_uint32(10), lf_intx(lf_uint64_t, 0x100000009ULL));
+	uint32_t expected = mixed(200, -5, 7, 0x500000000ULL, -3, &local, 10, 0x100000009ULL);
+	lf_test(call(mixed, lf_uint32_t, args) == expected, "A call with mixed arguments returned %u rather than %u.", (unsigned)call(mixed, lf_uint32_t, args), expected);
+
+	/* Each argument lands in its own slot, including those passed on the stack. */
+	for (int i = 0; i < 8; i ++) {
+		uint32_t v[8] = { 0 };
+		v[i] = 1;
+		args = lf_args(lf_uint32(v[0]), lf_uint32(v[1]), lf_uint32(v[2]), lf_uint32(v[3]), lf_uint32(v[4]), lf_uint32(v[5]), lf_uint32(v[6]), lf_uint32(v[7]));
+		lf_test(call(position, lf_uint32_t, args) == (lf_return_t)(i + 1), "Argument %i arrived as argument %u.", i + 1, (unsigned)call(position, lf_uint32_t, args));
+	}
+
+	/* Narrow signed arguments are sign extended, and narrow returns are truncated to their type. */
+	args = lf_args(lf_int8(5));
+	lf_test(call(negate, lf_int8_t, args) == (lf_return_t)-5, "A narrow signed return was not sign extended.");
+	args = lf_args(lf_int8(-128));
+	lf_test(call(negate, lf_uint8_t, args) == 0x80, "A narrow return was not truncated.");
+
+	/* 64-bit arguments keep their upper bits. */
+	args = lf_args(lf_intx(lf_uint64_t, 0x1234567800000000ULL));
+	lf_test(call(upper, lf_uint32_t, args) == 0x12345678, "A 64-bit argument lost its upper bits.");
+
+	/* Void calls return nothing. */
+	args = lf_args(lf_uint32(0xdeadbeef));
+	lf_test(call(nothing, lf_void_t, args) == 0, "A void call returned a value.");
+
+	/* Invalid return types are refused. */
+	args = lf_args(lf_int8(5));
+	lf_test(call(negate, 5, args) == (lf_return_t)lf_error, "A call with an invalid return type was made.");
+	lf_error_clear();
+
+	printf("dispatch: ok\n");
+	return EXIT_SUCCESS;
+}
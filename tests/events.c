@@ -0,0 +1,62 @@
+/* events.c - Checks that registered events are found by their identifier, through random registrations and removals. */
+
+#include "test.h"
+
+#define IDS 4096
+#define OPERATIONS 200000
+
+/* Checks that the table counts its events, has room to spare, and that a search finds each of them. */
+void check_table(void) {
+	struct _lf_event_table *table = &lf_get_event_list();
+	uint32_t found = 0;
+	for (uint32_t i = 0; i < table->size; i ++) {
+		if (!table->slots[i]) continue;
+		found ++;
+		lf_test(lf_event_for_id(table->slots[i]->id) == table->slots[i], "Event %u cannot be found from where it is held.", table->slots[i]->id);
+	}
+	lf_test(found == table->count, "The table holds %u events but counts %u.", found, table->count);
+	lf_test(table->count * 4 <= table->size * 3, "The table holds %u events in %u slots.", table->count, table->size);
+}
+
+int main(void) {
+	/* The reference holds the event registered with each identifier, if any. */
+	static lf_event *reference[IDS];
+	srand(7);
+	for (int op = 0; op < OPERATIONS; op ++) {
+		lf_event_id id = rand() % IDS + 1;
+		lf_event *event = reference[id - 1];
+		lf_test(lf_event_for_id(id) == event, "Looking up event %u found %p rather than %p.", id, (void *)lf_event_for_id(id), (void *)event);
+		if (!event) {
+			reference[id - 1] = lf_event_register(id, NULL, NULL);
+			lf_test(reference[id - 1], "Failed to register event %u.", id);
+		} else if (rand() % 2) {
+			lf_test(lf_event_unregister(event) == lf_success, "Failed to unregister event %u.", id);
+			reference[id - 1] = NULL;
+		}
+		if (op % 10000 == 0) check_table();
+	}
+	for (lf_event_id id = 1; id <= IDS; id ++) lf_test(lf_event_for_id(id) == reference[id - 1], "Event %u is not the one registered.", id);
+	check_table();
+
+	/* An identifier that is already registered is refused. */
+	lf_event_id id = 1;
+	if (!reference[id - 1]) reference[id - 1] = lf_event_register(id, NULL, NULL);
+	lf_error_pause();
+	lf_test(!lf_event_register(id, NULL, NULL), "An event was registered twice.");
+	lf_error_resume();
+	lf_error_clear();
+	lf_test(lf_event_for_id(id) == reference[id - 1], "Registering an event twice replaced it.");
+
+	/* Generated identifiers are never 0, and skip those that are registered. */
+	for (int i = 0; i < IDS; i ++) {
+		lf_event_id unique = lf_event_generate_unique_id();
+		lf_test(unique && !lf_event_for_id(unique), "Generated the identifier %u, which is in use.", unique);
+	}
+
+	for (int i = 0; i < IDS; i ++) if (reference[i]) lf_event_unregister(reference[i]);
+	lf_test(lf_get_event_list().count == 0, "%u events are still registered.", lf_get_event_list().count);
+	lf_test(!lf_event_for_id(id), "An unregistered event was found.");
+
+	printf("events: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,51 @@
+/* frames.c - Checks that packets are sent in frames only as long as they are, and never longer than the device accepts. */
+
+#include "device.h"
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	lf_test(device->frame_size == FMR_PACKET_SIZE, "A device starts with frames of %u bytes rather than %u.", device->frame_size, FMR_PACKET_SIZE);
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+	lf_test(device->frame_size == FMR_MAX_PACKET_SIZE, "The device accepts frames of %u bytes rather than %u.", device->frame_size, FMR_MAX_PACKET_SIZE);
+
+	/* The device checks that each frame is as long as the packet it carries. A small invocation takes less than a fixed packet. */
+	context->largest = 0;
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(1))) == 1, "Failed to invoke the device.");
+	lf_test(context->largest < FMR_PACKET_SIZE, "An invocation of one parameter was sent in a frame of %u bytes.", context->largest);
+
+	/* A push whose data fits in a larger frame is sent in one. */
+	uint8_t data[FMR_INLINE_SIZE];
+	memset(data, 1, sizeof(data));
+	uint32_t pushes = context->pushes;
+	context->largest = 0;
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, sizeof(data), NULL) == sizeof(data), "Failed to push to the device.");
+	lf_test(context->pushes == pushes + 1, "A push that fits in a frame took %u transfers.", context->pushes - pushes);
+	lf_test(context->largest > FMR_PACKET_SIZE && context->largest <= device->frame_size, "A push was sent in a frame of %u bytes.", context->largest);
+
+	/* On a device that accepts only fixed packets, as firmware that predates larger frames, the same push sends its data separately. */
+	device->frame_size = FMR_PACKET_SIZE;
+	pushes = context->pushes;
+	context->largest = 0;
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, sizeof(data), NULL) == sizeof(data), "Failed to push to a device that accepts only fixed packets.");
+	lf_test(context->pushes == pushes + 2, "A push that does not fit in a frame took %u transfers.", context->pushes - pushes);
+	lf_test(context->largest <= FMR_PACKET_SIZE, "A frame of %u bytes was sent to a device that accepts only %u.", context->largest, FMR_PACKET_SIZE);
+
+	/* A batch stops growing once it fills a frame, rather than sending one the device cannot take. */
+	struct _lf_batch batch;
+	lf_test(lf_batch_begin(&batch, device) == lf_success, "Failed to begin a batch.");
+	int added = 0;
+	lf_error_pause();
+	while (lf_batch_add(&batch, &module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(added))) == lf_success) added ++;
+	lf_error_resume();
+	lf_test(lf_error_get() == E_FMR_OVERFLOW && added > 0 && added < FMR_MAX_BATCH, "A batch stopped at %i invocations with error %i.", added, lf_error_get());
+	lf_error_clear();
+	lf_test(batch.packet.header.length <= FMR_PACKET_SIZE, "A batch of %u bytes was built for frames of %u.", batch.packet.header.length, FMR_PACKET_SIZE);
+	struct _fmr_result results[FMR_MAX_BATCH];
+	lf_test(lf_batch_commit(&batch, results) == lf_success, "Failed to commit a batch that fills a frame.");
+	for (int i = 0; i < added; i ++) lf_test(results[i].value == (lf_return_t)i, "Invocation %i of a full batch returned %u.", i, (uint32_t)results[i].value);
+
+	printf("frames: ok\n");
+	return EXIT_SUCCESS;
+}
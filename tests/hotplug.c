@@ -0,0 +1,53 @@
+/* hotplug.c - Checks that a Carbon device that is unplugged is reported without the lock of the attached devices held, and released along with its parts. */
+
+#include "test.h"
+#include <flipper/atomic.h>
+
+extern carbon_hotplug_func carbon_detached;
+int carbon_hotplug_left(struct _lf_endpoint *endpoint, void *_ctx);
+struct _lf_device *carbon_attach_endpoint(struct _lf_endpoint *endpoint, struct _lf_device *_u2, struct _lf_device *_4s);
+int carbon_select_atmegau2(struct _lf_device *device);
+int carbon_select_atsam4s(struct _lf_device *device);
+
+/* The device the application was told had left, and whether the lock was free when it was told. */
+struct _lf_device *detached;
+bool unlocked;
+
+void on_detached(struct _lf_device *device, void *_ctx) {
+	detached = device;
+	unlocked = lf_atomic_load(&lf_attached_lock.state) == 0;
+}
+
+struct _lf_endpoint *endpoint(void) {
+	struct _lf_endpoint *endpoint = lf_endpoint_create(NULL, NULL, lf_test_push, lf_test_pull, NULL, sizeof(struct _lf_test_context));
+	lf_test(endpoint, "Failed to create a test endpoint.");
+	return endpoint;
+}
+
+int main(void) {
+	/* The bridge is reached through its own endpoint, as it would be through USB, and the Carbon device through another shared with the 4S. */
+	struct _lf_endpoint *usb = endpoint();
+	struct _lf_device *_u2 = lf_device_create(usb, carbon_select_atmegau2, NULL, 0);
+	struct _lf_endpoint *bridged = endpoint();
+	struct _lf_device *_4s = lf_device_create(bridged, carbon_select_atsam4s, NULL, 0);
+	lf_test(_u2 && _4s, "Failed to create the sub-devices.");
+	struct _lf_device *carbon = carbon_attach_endpoint(bridged, _u2, _4s);
+	lf_test(carbon, "Failed to attach the Carbon device.");
+	lf_test(lf_vector_contains(&lf_attached_devices, carbon), "The Carbon device was not attached.");
+
+	/* A bridge that never arrived is ignored. */
+	carbon_detached = on_detached;
+	struct _lf_endpoint *other = endpoint();
+	lf_test(carbon_hotplug_left(other, NULL) == lf_success, "Failed to ignore an unknown endpoint.");
+	lf_test(!detached, "A device was reported for an unknown endpoint.");
+	lf_endpoint_release(other);
+
+	/* Unplugging the bridge reports and detaches the device it was part of. The endpoints and sub-devices are released with it, which a leak check would catch otherwise. */
+	lf_test(carbon_hotplug_left(usb, NULL) == lf_success, "Failed to handle the bridge leaving.");
+	lf_test(detached == carbon, "The Carbon device was not reported as having left.");
+	lf_test(unlocked, "The application was told that the device left with the lock of the attached devices held.");
+	lf_test(lf_vector_count(&lf_attached_devices) == 0, "The Carbon device is still attached.");
+
+	printf("hotplug: ok\n");
+	return EXIT_SUCCESS;
+}
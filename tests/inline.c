@@ -0,0 +1,46 @@
+/* inline.c - Checks that small pushes and pulls carry their data in the packet and its reply, and that their data arrives intact. */
+
+#include "device.h"
+
+/* Pushes and then pulls back the given number of bytes, checking the number of transfers each takes in either direction. */
+void round_trip(struct _lf_module *module, struct _lf_test_fmr_context *context, lf_size_t length, uint32_t transfers) {
+	uint8_t data[LF_TEST_FMR_DATA_SIZE], copy[LF_TEST_FMR_DATA_SIZE];
+	uint32_t sum = 0;
+	for (lf_size_t i = 0; i < length; i ++) sum += data[i] = length + i * 13;
+	memset(copy, 0, length);
+
+	uint32_t pushes = context->pushes, pulls = context->pulls;
+	lf_test(lf_push(module, lf_test_fmr_store_f, data, length, NULL) == sum, "A push of %u bytes returned the wrong sum.", length);
+	lf_test(context->pushes - pushes == transfers && context->pulls - pulls == 1, "A push of %u bytes took %u transfers out and %u back.", length, context->pushes - pushes, context->pulls - pulls);
+	lf_test(context->stored_length == length && !memcmp(context->stored, data, length), "A push of %u bytes arrived corrupted.", length);
+
+	pushes = context->pushes, pulls = context->pulls;
+	lf_test(lf_pull(module, lf_test_fmr_load_f, copy, length, NULL) == length, "A pull of %u bytes failed.", length);
+	lf_test(context->pushes - pushes == 1 && context->pulls - pulls == transfers, "A pull of %u bytes took %u transfers out and %u back.", length, context->pushes - pushes, context->pulls - pulls);
+	lf_test(!memcmp(copy, data, length), "A pull of %u bytes arrived corrupted.", length);
+}
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+
+	/* Up to the threshold, the data rides along with the packet and with its result. */
+	round_trip(&module, context, 1, 1);
+	round_trip(&module, context, 16, 1);
+	round_trip(&module, context, FMR_INLINE_SIZE, 1);
+
+	/* Past it, the data takes a transfer of its own. */
+	round_trip(&module, context, FMR_INLINE_SIZE + 1, 2);
+	round_trip(&module, context, 1024, 2);
+
+	/* A device that does not support inline data is always sent it separately. */
+	device->configuration.capabilities &= ~lf_capability_inline;
+	round_trip(&module, context, 16, 2);
+
+	lf_test(context->head == context->tail, "%u replies were left unpulled.", context->tail - context->head);
+
+	printf("inline: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/* late.c - Checks that the result of an abandoned invocation, arriving late, is not taken as the reply to the packets sent after it. */
+
+#include "device.h"
+
+/* Sends an invocation whose result is late, so that it is abandoned and its result left for the next packet to skip. */
+void abandon(struct _lf_module *module, struct _lf_device *device, uint32_t value) {
+	struct _lf_completion *completion = lf_invoke_async(module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(value)));
+	lf_test(completion, "Failed to send the invocation to abandon.");
+	lf_test_fmr_context(device)->failures = 1;
+	lf_test(lf_await(completion) == (lf_return_t)-1, "An invocation whose result was late succeeded.");
+	lf_error_clear();
+}
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+
+	uint8_t data[256], copy[256];
+	for (int i = 0; i < (int)sizeof(data); i ++) data[i] = i * 7;
+
+	/* Pushes and pulls, both inline and with their data in a transfer of its own. */
+	for (lf_size_t length = 16; length <= sizeof(data); length *= 16) {
+		uint32_t expected = 0;
+		for (lf_size_t i = 0; i < length; i ++) expected += data[i];
+		abandon(&module, device, 77);
+		lf_test(lf_push(&module, lf_test_fmr_store_f, data, length, NULL) == expected, "A push of %u bytes returned the late result of another invocation.", length);
+		abandon(&module, device, 78);
+		memset(copy, 0, sizeof(copy));
+		lf_test(lf_pull(&module, lf_test_fmr_load_f, copy, length, NULL) == length, "A pull of %u bytes returned the late result of another invocation.", length);
+		lf_test(!memcmp(copy, data, length), "A pull of %u bytes took the late result of another invocation as its data.", length);
+	}
+
+	/* A drain and a reload of the configuration skip the late result as well. */
+	abandon(&module, device, 79);
+	lf_test(lf_sync(device) == lf_success, "A drain failed after an invocation was abandoned.");
+	abandon(&module, device, 80);
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to reload the configuration after an invocation was abandoned.");
+	lf_test(device->configuration.frame_size == FMR_MAX_PACKET_SIZE, "The configuration was read from the late result of another invocation.");
+
+	/* A failure of a packet sent without a reply, collected while the late results are skipped, is still reported by the drain. */
+	lf_test(lf_set_deferred(device, true) == lf_success, "Failed to defer invocations.");
+	lf_invoke(&module, lf_test_fmr_raise_f, lf_void_t, lf_args(lf_uint32(E_OVERFLOW)));
+	abandon(&module, device, 82);
+	lf_test(lf_pull(&module, lf_test_fmr_load_f, copy, sizeof(copy), NULL) == sizeof(data) && !memcmp(copy, data, sizeof(data)), "A pull after a deferred failure and a late result failed.");
+	lf_error_pause();
+	lf_test(lf_sync(device) == lf_error && lf_error_get() == E_OVERFLOW, "A deferred failure collected before the drain was not reported by it.");
+	lf_error_resume();
+	lf_error_clear();
+	lf_test(lf_set_deferred(device, false) == lf_success, "A deferred failure was reported twice.");
+
+	/* Nothing is left to be pulled, and invocations go on to return their own results. */
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(81))) == 81, "The invocation after the late results failed.");
+	lf_test(context->head == context->tail, "%u replies were left unpulled.", context->tail - context->head);
+
+	/* A push whose own result cannot be pulled fails, rather than returning whatever the result held. */
+	context->failures = 2;
+	lf_error_pause();
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, 16, NULL) == (lf_return_t)lf_error, "A push whose result could not be pulled succeeded.");
+	lf_error_resume();
+	lf_error_clear();
+
+	printf("late: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/* link.c - Checks that an emulated link delays and loses transfers as described, and repeatably. */
+
+#include "device.h"
+#include <flipper/posix/link.h>
+#include <time.h>
+
+double now(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/* The device behind the link most recently created. */
+struct _lf_test_fmr_context *context;
+
+/* Creates a device whose transfers cross a link described as given. */
+struct _lf_device *create(struct _lf_module *module, const char *description, struct _lf_link_context **link) {
+	struct _lf_device *device = lf_test_fmr_create(module);
+	context = lf_test_fmr_context(device);
+	struct _lf_endpoint *endpoint = lf_link_endpoint_for_endpoint(device->endpoint, description);
+	lf_test(endpoint, "Failed to emulate the link '%s'.", description);
+	device->endpoint = endpoint;
+	*link = endpoint->_ctx;
+	return device;
+}
+
+/* Invokes the device the given number of times, returning how many invocations failed. */
+int invoke(struct _lf_module *module, int count) {
+	int failed = 0;
+	lf_error_pause();
+	for (int i = 0; i < count; i ++) {
+		if (lf_invoke(module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(i))) != (lf_return_t)i) failed ++;
+		lf_error_clear();
+	}
+	lf_error_resume();
+	return failed;
+}
+
+int main(void) {
+	struct _lf_module module;
+	struct _lf_link_context *link;
+
+	/* The latency is added to every transfer, and the bandwidth limits those that are large. */
+	struct _lf_device *device = create(&module, "latency=2000", &link);
+	double start = now();
+	lf_test(invoke(&module, 10) == 0, "Invocations over a slow link failed.");
+	double elapsed = now() - start;
+	lf_test(link->transfers == 20 && link->delay == 20 * 2000, "%llu transfers were delayed by %llu us.", (unsigned long long)link->transfers, (unsigned long long)link->delay);
+	lf_test(elapsed >= 0.040, "Invocations over a link with 2 ms of latency took %.3f ms.", elapsed * 1e3);
+	lf_endpoint_release(device->endpoint);
+
+	device = create(&module, "bandwidth=100000", &link);
+	uint8_t data[1000];
+	memset(data, 0, sizeof(data));
+	start = now();
+	lf_test(lf_push(&module, lf_test_fmr_store_f, data, sizeof(data), NULL) == 0, "A push over a narrow link failed.");
+	elapsed = now() - start;
+	lf_test(elapsed >= 0.010, "A push of 1000 bytes at 100000 bytes per second took %.3f ms.", elapsed * 1e3);
+	lf_endpoint_release(device->endpoint);
+
+	/* A link that loses everything fails every invocation, without the device seeing them. */
+	device = create(&module, "drop=1", &link);
+	lf_test(invoke(&module, 5) == 5, "Invocations over a link that loses everything succeeded.");
+	lf_test(context->packets == 0, "The device performed a packet that was lost.");
+	lf_endpoint_release(device->endpoint);
+
+	/* Losses are random, but repeat for the same seed. */
+	int failed[3];
+	uint64_t dropped[3];
+	const char *descriptions[] = { "drop=0.25,seed=3", "drop=0.25,seed=3", "drop=0.25,seed=4" };
+	for (int i = 0; i < 3; i ++) {
+		device = create(&module, descriptions[i], &link);
+		failed[i] = invoke(&module, 200);
+		dropped[i] = link->dropped;
+		lf_endpoint_release(device->endpoint);
+	}
+	lf_test(failed[0] > 0 && failed[0] < 200, "%i of 200 invocations failed over a link that loses a quarter of its transfers.", failed[0]);
+	lf_test(failed[0] == failed[1] && dropped[0] == dropped[1], "The same seed lost %llu and then %llu transfers.", (unsigned long long)dropped[0], (unsigned long long)dropped[1]);
+	lf_test(dropped[0] != dropped[2], "Different seeds lost the same transfers.");
+
+	/* Descriptions that cannot be understood are refused. */
+	struct _lf_endpoint *endpoint = lf_endpoint_create(NULL, NULL, lf_test_fmr_push, lf_test_fmr_pull, NULL, sizeof(struct _lf_test_fmr_context));
+	lf_error_pause();
+	lf_test(!lf_link_endpoint_for_endpoint(endpoint, "latency"), "A parameter without a value was accepted.");
+	lf_test(!lf_link_endpoint_for_endpoint(endpoint, "speed=1"), "An unknown parameter was accepted.");
+	lf_error_resume();
+	lf_error_clear();
+	/* The endpoint is not taken over by a link that failed to be set up. */
+	lf_test(lf_link_endpoint_for_endpoint(endpoint, "carbon"), "Failed to emulate the Carbon link.");
+
+	printf("link: ok\n");
+	return EXIT_SUCCESS;
+}
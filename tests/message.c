@@ -0,0 +1,103 @@
+/* message.c - Checks that messages sent over an endpoint come out of the incoming queue on the other side, and are applied among results. */
+
+#include "test.h"
+#include <flipper/posix/reactor.h>
+#include <flipper/posix/stream.h>
+#include <sys/socket.h>
+#include <pthread.h>
+
+/* The receipt event, and the number of times it was triggered. */
+lf_event_id id;
+int receipts;
+
+void receipt(struct _lf_event *event) {
+	receipts ++;
+}
+
+/* Sends a message of the event kind with the given number and receipt event over the endpoint. */
+void send_message(struct _lf_endpoint *endpoint, int number, lf_event_id id) {
+	struct _lf_msg *msg = lf_msg_create(lf_msg_event_kind);
+	lf_test(msg, "Failed to create a message.");
+	msg->message_number = number;
+	msg->event_id = id;
+	lf_test(lf_msg_send(msg, endpoint) == lf_success, "Failed to send a message.");
+	lf_msg_release(msg);
+}
+
+/* Delivers a message with the receipt event to the endpoint, as a thread other than the event loop would. */
+void *deliver(void *_endpoint) {
+	struct _lf_endpoint *endpoint = _endpoint;
+	usleep(50000);
+	struct _lf_msg *msg = lf_msg_create(lf_msg_event_kind);
+	lf_test(msg, "Failed to create a message.");
+	msg->event_id = id;
+	lf_test(lf_endpoint_deliver(endpoint, msg) == lf_success, "Failed to deliver a message.");
+	return NULL;
+}
+
+int main(void) {
+	int fds[2];
+	lf_test(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "Failed to create a socket pair.");
+	struct _lf_endpoint *peer = lf_stream_endpoint_for_socket(fds[1], "peer");
+	struct _lf_endpoint *endpoint = lf_stream_endpoint_for_socket(fds[0], "message");
+	lf_test(peer && endpoint, "Failed to create the endpoints.");
+
+	/* A message received over the endpoint is delivered to its incoming queue as it was sent. */
+	send_message(peer, 3, 7);
+	struct _fmr_packet frame;
+	lf_test(endpoint->pull(endpoint, &frame, sizeof(frame)) == lf_success, "The message did not arrive.");
+	lf_test(lf_msg_framed(&frame), "The message was not recognized.");
+	lf_test(lf_msg_receive(endpoint, &frame) == lf_success, "Failed to receive the message.");
+	struct _lf_msg *msg = lf_endpoint_dequeue(endpoint);
+	lf_test(msg, "The message did not come out of the incoming queue.");
+	lf_test(msg->kind == lf_msg_event_kind && msg->message_number == 3 && msg->event_id == 7, "The message came out as kind %i, number %i, event %u.", msg->kind, msg->message_number, msg->event_id);
+	lf_msg_release(msg);
+	lf_test(!lf_endpoint_dequeue(endpoint), "The incoming queue held more than the message.");
+
+	/* A result is not taken for a message. */
+	struct _fmr_result result = { 0, E_OK, fmr_event_class };
+	lf_test(peer->push(peer, &result, sizeof(result)) == lf_success, "Failed to send a result.");
+	memset(&frame, 0, sizeof(struct _fmr_header));
+	lf_test(endpoint->pull(endpoint, &frame, sizeof(frame)) == lf_success, "The result did not arrive.");
+	lf_test(!lf_msg_framed(&frame), "A result was taken for a message.");
+
+	/* Waited on by the event loop, a message that arrives ahead of a result triggers its receipt event, and the result is still filed. */
+	struct _lf_device *device = lf_device_create(endpoint, NULL, NULL, 0);
+	lf_test(device, "Failed to create the device.");
+	lf_lock(&lf_attached_lock);
+	lf_vector_append(&lf_attached_devices, device);
+	lf_unlock(&lf_attached_lock);
+	lf_test(lf_reactor_register(device) == lf_success, "Failed to wait on the device.");
+	id = lf_event_generate_unique_id();
+	struct _lf_event *event = lf_event_register(id, receipt, NULL);
+	lf_test(event, "Failed to register the receipt event.");
+
+	struct _lf_module module = { "message", NULL, LF_VERSION, 0, 0, device, NULL, NULL };
+	struct _lf_completion *completion = lf_invoke_async(&module, 0, lf_uint32_t, lf_args(lf_uint32(42)));
+	lf_test(completion, "Failed to send the invocation.");
+	struct _fmr_packet packet;
+	lf_test(peer->pull(peer, &packet, sizeof(packet)) == lf_success, "The invocation did not arrive.");
+	send_message(peer, 4, id);
+	result = (struct _fmr_result){ 42, E_OK, packet.header.sequence };
+	lf_test(peer->push(peer, &result, sizeof(result)) == lf_success, "Failed to send the result.");
+	lf_test(lf_reactor_poll(1000) == 1, "The event loop did not wake for the message.");
+	lf_test(receipts == 1, "The receipt event was triggered %i times.", receipts);
+	lf_test(completion->state == lf_completion_done, "The result that followed the message was not filed.");
+	lf_test(lf_await(completion) == 42, "The result was not returned by the completion.");
+	lf_test(!lf_endpoint_has_data(endpoint), "The message was left in the incoming queue.");
+
+	/* A message delivered by another thread wakes the event loop, rather than waiting for the device to send something. */
+	pthread_t thread;
+	pthread_create(&thread, NULL, deliver, endpoint);
+	/* Wakes for messages that were already handled may come first. */
+	for (int i = 0; i < 50 && receipts < 2; i ++) lf_reactor_poll(100);
+	pthread_join(thread, NULL);
+	lf_test(receipts == 2, "The event loop did not wake for a delivered message.");
+	lf_test(!lf_endpoint_has_data(endpoint), "The delivered message was left in the incoming queue.");
+
+	lf_event_unregister(event);
+	lf_endpoint_release(peer);
+	lf_detach(device);
+	printf("message: ok\n");
+	return EXIT_SUCCESS;
+}
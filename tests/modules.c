@@ -0,0 +1,46 @@
+/* modules.c - Checks that modules are looked up on the device asked about, rather than on the selected device, and only once. */
+
+#include "test.h"
+
+int main(void) {
+	struct _lf_module a_module, b_module;
+	struct _lf_device *a = lf_test_device_create("a", &a_module);
+	struct _lf_device *b = lf_test_device_create("b", &b_module);
+
+	/* The loader is a standard module, found on each device where its selector would route it. */
+	struct _lf_device *devices[] = { a, b };
+	for (int i = 0; i < 2; i ++) {
+		devices[i]->routes[0] = (struct _lf_route){ &_fld, devices[i], 0 };
+		devices[i]->route_count = 1;
+	}
+
+	/* Neither device reports its module table, so each lookup is a call to the device. The test device answers with the identifier. */
+	lf_set_thread_device(b);
+	int index = lf_module_index(a, 0x1234);
+	lf_test(index == 0x1234, "The lookup returned %i.", index);
+	lf_test(lf_test_context(a)->pushes == 1, "The device asked about was sent %i packets.", lf_test_context(a)->pushes);
+	lf_test(lf_test_context(b)->pushes == 0, "The selected device was sent %i packets.", lf_test_context(b)->pushes);
+
+	/* The selection is left as it was. */
+	lf_test(lf_get_current_device() == b, "The lookup changed the selected device.");
+
+	/* A module without an index is looked up on each device the first time it is invoked there, and not again. */
+	struct _lf_module user;
+	memset(&user, 0, sizeof(struct _lf_module));
+	user.name = "user";
+	user.index = -1;
+	for (int i = 0; i < 2; i ++) {
+		lf_set_thread_device(devices[i]);
+		for (uint32_t call = 1; call <= 3; call ++) {
+			lf_return_t value = lf_invoke(&user, 0, lf_uint32_t, lf_args(lf_uint32(call)));
+			lf_test(value == call, "Call %u returned %u.", call, (unsigned)value);
+		}
+	}
+	lf_test(lf_test_context(a)->pushes == 1 + 4, "The first device was sent %i packets for 3 calls.", lf_test_context(a)->pushes);
+	lf_test(lf_test_context(b)->pushes == 4, "The second device was sent %i packets for 3 calls.", lf_test_context(b)->pushes);
+
+	lf_device_release(a);
+	lf_device_release(b);
+	printf("modules: ok\n");
+	return EXIT_SUCCESS;
+}
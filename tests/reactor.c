@@ -0,0 +1,50 @@
+/* reactor.c - Checks that the event loop takes what arrives from a device, and stops waiting on a device whose peer has gone. */
+
+#include "test.h"
+#include <flipper/posix/reactor.h>
+#include <flipper/posix/stream.h>
+#include <sys/socket.h>
+
+int main(void) {
+	/* The device is reached over one end of a socket pair, and the test answers for it over the other. */
+	int fds[2];
+	lf_test(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "Failed to create a socket pair.");
+	struct _lf_endpoint *peer = lf_stream_endpoint_for_socket(fds[1], "peer");
+	struct _lf_device *device = lf_device_create(lf_stream_endpoint_for_socket(fds[0], "reactor"), NULL, NULL, 0);
+	lf_test(peer && device, "Failed to create the device.");
+
+	/* Added to the attached devices without being configured, as there is nothing to answer the configuration. */
+	lf_lock(&lf_attached_lock);
+	lf_vector_append(&lf_attached_devices, device);
+	lf_unlock(&lf_attached_lock);
+	lf_test(lf_reactor_register(device) == lf_success, "Failed to wait on the device.");
+	lf_test(lf_reactor_poll(0) == 0, "The event loop woke with nothing to handle.");
+
+	/* Data that nothing is waiting for is taken and dropped, rather than waking the loop again. */
+	uint8_t stray[8] = { 0 };
+	lf_test(peer->push(peer, stray, sizeof(stray)) == lf_success, "Failed to send stray data.");
+	lf_test(lf_reactor_poll(1000) == 1, "The event loop did not wake for stray data.");
+	lf_test(lf_reactor_poll(0) == 0, "The event loop woke again for the same stray data.");
+
+	/* The result of an invocation sent without waiting is filed under its completion. */
+	struct _lf_module module = { "reactor", NULL, LF_VERSION, 0, 0, device, NULL, NULL };
+	struct _lf_completion *completion = lf_invoke_async(&module, 0, lf_uint32_t, lf_args(lf_uint32(42)));
+	lf_test(completion, "Failed to send the invocation.");
+	struct _fmr_packet packet;
+	lf_test(peer->pull(peer, &packet, sizeof(packet)) == lf_success, "The invocation did not arrive.");
+	struct _fmr_result result = { 42, E_OK, packet.header.sequence };
+	lf_test(peer->push(peer, &result, sizeof(result)) == lf_success, "Failed to send the result.");
+	lf_test(lf_reactor_poll(1000) == 1, "The event loop did not wake for the result.");
+	lf_test(completion->state == lf_completion_done, "The result was not filed under its completion.");
+	lf_test(lf_reactor_poll(0) == 0, "The event loop woke again for the same result.");
+	lf_test(lf_await(completion) == 42, "The result was not returned by the completion.");
+
+	/* A peer that closes its end stops the device from being waited on, rather than waking the loop forever. */
+	lf_endpoint_release(peer);
+	lf_test(lf_reactor_poll(1000) == 1, "The event loop did not wake when the peer went away.");
+	lf_test(lf_reactor_poll(0) == 0, "The event loop woke again after the peer went away.");
+
+	lf_detach(device);
+	printf("reactor: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/* replay.c - Checks that a recorded session replays to the same results, without the device it was recorded from. */
+
+#include "device.h"
+#include <flipper/posix/trace.h>
+
+/* The results of a session, to be compared between recording and replay. */
+struct session {
+	lf_return_t values[8];
+	uint8_t pulled[256];
+	struct _fmr_result batched[3];
+};
+
+/* The data pushed and pulled. Their addresses are sent to the device, so they are the same in both sessions. */
+uint8_t data[256], pulled[256];
+
+/* Exchanges a little of everything with the device: invocations, pushes and pulls of both sizes, a batch, and an invocation whose result is late. */
+void run(struct _lf_module *module, struct _lf_device *device, struct session *session, struct _lf_test_fmr_context *context) {
+	for (int i = 0; i < (int)sizeof(data); i ++) data[i] = i * 3;
+	memset(session, 0, sizeof(struct session));
+	memset(pulled, 0, sizeof(pulled));
+	lf_test(lf_load_configuration(device) == lf_success, "Failed to load the configuration.");
+	session->values[0] = lf_invoke(module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(11)));
+	session->values[1] = lf_push(module, lf_test_fmr_store_f, data, 16, NULL);
+	session->values[2] = lf_pull(module, lf_test_fmr_load_f, pulled, 16, NULL);
+	session->values[3] = lf_push(module, lf_test_fmr_store_f, data, sizeof(data), NULL);
+	session->values[4] = lf_pull(module, lf_test_fmr_load_f, pulled, sizeof(pulled), NULL);
+	memcpy(session->pulled, pulled, sizeof(pulled));
+	struct _lf_batch batch;
+	lf_batch_begin(&batch, device);
+	for (uint32_t i = 0; i < 3; i ++) lf_batch_add(&batch, module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(20 + i)));
+	session->values[5] = lf_batch_commit(&batch, session->batched);
+	/* While recording, the result of this invocation is late. The replay must fail it and skip its result in the same way. */
+	if (context) context->failures = 1;
+	lf_error_pause();
+	session->values[6] = lf_invoke(module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(12)));
+	lf_error_resume();
+	lf_error_clear();
+	session->values[7] = lf_invoke(module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(13)));
+}
+
+int main(void) {
+	char path[] = "/tmp/lf_replay_XXXXXX";
+	int fd = mkstemp(path);
+	lf_test(fd >= 0, "Failed to create a file for the trace.");
+	close(fd);
+
+	/* Record a session with the device. */
+	struct _lf_module module;
+	struct _lf_device *device = lf_test_fmr_create(&module);
+	struct _lf_test_fmr_context *context = lf_test_fmr_context(device);
+	struct _lf_endpoint *endpoint = lf_record_endpoint_for_endpoint(device->endpoint, path);
+	lf_test(endpoint, "Failed to record the device.");
+	device->endpoint = endpoint;
+	struct session recorded;
+	run(&module, device, &recorded, context);
+	lf_test(recorded.values[0] == 11 && recorded.values[7] == 13 && recorded.values[6] == (lf_return_t)-1, "The recorded session did not go as expected.");
+	/* Releasing the recorder closes the trace, and releases the device it was recorded from. */
+	lf_endpoint_release(endpoint);
+
+	/* Replay it. The trace is read up front, so it can be removed before the replay starts. */
+	endpoint = lf_replay_endpoint_for_path(path);
+	lf_test(endpoint, "Failed to replay the trace.");
+	unlink(path);
+	device = lf_device_create(endpoint, NULL, NULL, 0);
+	module.device = device;
+	struct session replayed;
+	run(&module, device, &replayed, NULL);
+	lf_test(!memcmp(&recorded, &replayed, sizeof(struct session)), "The replayed session returned different results from the recorded one.");
+	struct _lf_replay_context *replay = endpoint->_ctx;
+	lf_test(replay->differed == 0 && replay->skipped == 0, "The replay differed from the trace in %llu pushes and skipped %llu records.", (unsigned long long)replay->differed, (unsigned long long)replay->skipped);
+	lf_test(replay->cursor == replay->size, "%zu bytes of the trace were not replayed.", replay->size - replay->cursor);
+
+	/* Once the trace runs out, transfers fail. */
+	lf_error_pause();
+	lf_test(lf_invoke(&module, lf_test_fmr_echo_f, lf_uint32_t, lf_args(lf_uint32(14))) == (lf_return_t)-1, "An invocation past the end of the trace succeeded.");
+	lf_error_resume();
+	lf_error_clear();
+
+	/* A file that is not a trace is refused. */
+	lf_error_pause();
+	lf_test(!lf_replay_endpoint_for_path(path), "A trace that was removed was replayed.");
+	lf_test(!lf_replay_endpoint_for_path("/dev/null"), "An empty file was replayed.");
+	lf_error_resume();
+	lf_error_clear();
+
+	printf("replay: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/* slab.c - Checks that slabs hand out each of their objects once, reuse the most recently freed first, and fail or overflow once they run out. */
+
+#include "test.h"
+#include <flipper/slab.h>
+#include <pthread.h>
+
+#define COUNT 8
+#define THREADS 4
+#define ROUNDS 100000
+
+struct item {
+	uint64_t owner;
+	uint8_t padding[24];
+};
+
+LF_SLAB_DEFINE(test_slab, struct item, COUNT);
+LF_SLAB_DEFINE(shared_slab, struct item, COUNT);
+
+/* Returns the number of objects on the slab's free list. */
+uint32_t free_count(struct _lf_slab *slab) {
+	uint32_t free = 0;
+	for (uint32_t first = slab->top & 0xffff; first && free <= slab->count; first = slab->links[first - 1]) free ++;
+	return free;
+}
+
+/* Takes objects from the shared slab and returns them, checking that no other thread holds an object while this one does. */
+void *churn(void *argument) {
+	uint64_t self = (uintptr_t)argument;
+	for (int round = 0; round < ROUNDS; round ++) {
+		struct item *held[2];
+		for (int i = 0; i < 2; i ++) {
+			held[i] = lf_slab_alloc(&shared_slab);
+			lf_test(held[i] && lf_slab_owns(&shared_slab, held[i]), "Failed to take an object from a slab large enough for every thread.");
+			held[i]->owner = self;
+		}
+		for (int i = 0; i < 2; i ++) {
+			lf_test(held[i]->owner == self, "An object was handed to two threads at once.");
+			lf_slab_free(&shared_slab, held[i]);
+		}
+	}
+	return NULL;
+}
+
+int main(void) {
+	/* Every object is handed out once, and they do not overlap. */
+	test_slab.overflow = false;
+	struct item *items[COUNT];
+	for (int i = 0; i < COUNT; i ++) {
+		items[i] = lf_slab_alloc(&test_slab);
+		lf_test(items[i] && lf_slab_owns(&test_slab, items[i]), "Object %i was not taken from the slab.", i);
+		for (int j = 0; j < i; j ++) lf_test(items[i] != items[j], "Object %i was handed out twice.", j);
+		memset(items[i], i, sizeof(struct item));
+	}
+	for (int i = 0; i < COUNT; i ++) lf_test(items[i]->padding[0] == i, "Object %i overlaps another.", i);
+	lf_test(test_slab.fresh == COUNT, "%u objects were used rather than %u.", test_slab.fresh, COUNT);
+
+	/* An exhausted slab that may not overflow fails, and counts the failure. */
+	lf_error_pause();
+	lf_test(!lf_slab_alloc(&test_slab) && lf_error_get() == E_MALLOC, "An exhausted slab handed out an object.");
+	lf_error_resume();
+	lf_error_clear();
+	lf_test(test_slab.exhausted == 1, "The slab was exhausted %u times rather than once.", test_slab.exhausted);
+
+	/* Objects are reused in the reverse of the order they were returned in. */
+	lf_slab_free(&test_slab, items[2]);
+	lf_slab_free(&test_slab, items[5]);
+	lf_slab_free(&test_slab, items[3]);
+	lf_test(lf_slab_alloc(&test_slab) == items[3], "The object returned last was not reused first.");
+	lf_test(lf_slab_alloc(&test_slab) == items[5], "The objects returned were not reused in reverse.");
+	lf_test(lf_slab_alloc(&test_slab) == items[2], "The object returned first was not reused last.");
+	lf_slab_free(&test_slab, NULL);
+
+	/* A slab that may overflow takes objects from the heap once its own are in use, and frees them when they are returned. */
+	test_slab.overflow = true;
+	struct item *extra = lf_slab_alloc(&test_slab);
+	lf_test(extra && !lf_slab_owns(&test_slab, extra), "An exhausted slab that may overflow did not take an object from the heap.");
+	lf_test(test_slab.exhausted == 2, "An overflow was not counted as an exhaustion.");
+	lf_slab_free(&test_slab, extra);
+	lf_test(free_count(&test_slab) == 0, "An object from the heap was put on the free list.");
+	for (int i = 0; i < COUNT; i ++) lf_slab_free(&test_slab, items[i]);
+	lf_test(free_count(&test_slab) == COUNT, "%u of %u objects are free after all were returned.", free_count(&test_slab), COUNT);
+
+	/* The number of objects ever taken is the most that have been in use at once, as freed objects are reused first. */
+	for (int round = 0; round < 100; round ++) {
+		for (int i = 0; i < 3; i ++) items[i] = lf_slab_alloc(&test_slab);
+		for (int i = 0; i < 3; i ++) lf_slab_free(&test_slab, items[i]);
+	}
+	lf_test(test_slab.fresh == COUNT, "Reusing objects raised the high-water mark to %u.", test_slab.fresh);
+	shared_slab.overflow = false;
+	for (int i = 0; i < 3; i ++) items[i] = lf_slab_alloc(&shared_slab);
+	for (int i = 0; i < 3; i ++) lf_slab_free(&shared_slab, items[i]);
+	for (int i = 0; i < 2; i ++) items[i] = lf_slab_alloc(&shared_slab);
+	lf_test(shared_slab.fresh == 3, "The high-water mark is %u after at most 3 objects were in use.", shared_slab.fresh);
+	for (int i = 0; i < 2; i ++) lf_slab_free(&shared_slab, items[i]);
+
+	/* Threads taking and returning objects at once are never handed the same one, and none are lost. */
+	pthread_t threads[THREADS];
+	for (uintptr_t i = 0; i < THREADS; i ++) pthread_create(&threads[i], NULL, churn, (void *)(i + 1));
+	for (int i = 0; i < THREADS; i ++) pthread_join(threads[i], NULL);
+	lf_test(shared_slab.fresh <= COUNT && shared_slab.exhausted == 0, "The slab ran out while shared by %i threads.", THREADS);
+	lf_test(free_count(&shared_slab) == shared_slab.fresh, "%u of %u objects are free after every thread returned its own.", free_count(&shared_slab), shared_slab.fresh);
+
+	printf("slab: ok\n");
+	return EXIT_SUCCESS;
+}
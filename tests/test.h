@@ -0,0 +1,88 @@
+/* test.h - Checks shared by the tests. Each test is a program that exits with a failure status if any of its checks fail. */
+
+#ifndef __lf_test_h__
+#define __lf_test_h__
+
+#include <flipper.h>
+
+/* Fails the test, printing where and why, if the condition is false. */
+#define lf_test(_condition, ...) \
+	do { \
+		if (!(_condition)) { \
+			fprintf(stderr, "%s:%i: Check '%s' failed. ", __FILE__, __LINE__, #_condition); \
+			fprintf(stderr, __VA_ARGS__); \
+			fprintf(stderr, "\n"); \
+			exit(EXIT_FAILURE); \
+		} \
+	} while (0)
+
+/* The most results the test device holds before they are pulled. */
+#define LF_TEST_MAX_RESULTS 64
+
+/* A device answered within the test itself. Each invocation returns its first parameter, so that results can be told apart. */
+struct _lf_test_context {
+	/* The results that have been answered but not yet pulled, oldest first. */
+	struct _fmr_result results[LF_TEST_MAX_RESULTS];
+	uint32_t head, tail;
+	/* The number of pulls to fail, and whether the result a failed pull would have returned is lost or merely late. */
+	int failures;
+	bool lose;
+	/* The number of packets pushed and results pulled. */
+	uint32_t pushes, pulls;
+};
+
+static inline int lf_test_push(struct _lf_endpoint *endpoint, void *source, lf_size_t length) {
+	struct _lf_test_context *context = endpoint->_ctx;
+	struct _fmr_packet *packet = source;
+	context->pushes ++;
+	if (packet->header.flags & FMR_FLAG_NO_REPLY) return lf_success;
+	if (context->tail - context->head == LF_TEST_MAX_RESULTS) return lf_error;
+	struct _fmr_result *result = &context->results[context->tail ++ % LF_TEST_MAX_RESULTS];
+	memset(result, 0, sizeof(struct _fmr_result));
+	result->sequence = packet->header.sequence;
+	if (packet->header.type == fmr_standard_invocation_class || packet->header.type == fmr_user_invocation_class) {
+		struct _fmr_invocation *call = &((struct _fmr_invocation_packet *)packet)->call;
+		uint32_t value = 0;
+		if (call->argc) memcpy(&value, call->parameters, sizeof(uint32_t));
+		result->value = value;
+	} else if (packet->header.type != fmr_sync_class) {
+		/* Answer every other packet as firmware that does not know it would. */
+		result->error = E_SUBCLASS;
+	}
+	return lf_success;
+}
+
+static inline int lf_test_pull(struct _lf_endpoint *endpoint, void *destination, lf_size_t length) {
+	struct _lf_test_context *context = endpoint->_ctx;
+	/* A pull with nothing to return times out at once, rather than blocking the test. */
+	if (context->head == context->tail || length != sizeof(struct _fmr_result)) return lf_error;
+	if (context->failures) {
+		context->failures --;
+		if (context->lose) context->head ++;
+		return lf_error;
+	}
+	memcpy(destination, &context->results[context->head ++ % LF_TEST_MAX_RESULTS], sizeof(struct _fmr_result));
+	context->pulls ++;
+	return lf_success;
+}
+
+/* Creates a device answered by the test, and a module that is invoked on it. */
+static inline struct _lf_device *lf_test_device_create(char *name, struct _lf_module *module) {
+	struct _lf_endpoint *endpoint = lf_endpoint_create(NULL, NULL, lf_test_push, lf_test_pull, NULL, sizeof(struct _lf_test_context));
+	lf_test(endpoint, "Failed to create the test endpoint.");
+	struct _lf_device *device = lf_device_create(endpoint, NULL, NULL, 0);
+	lf_test(device, "Failed to create the test device.");
+	strncpy(device->configuration.name, name, sizeof(device->configuration.name) - 1);
+	memset(module, 0, sizeof(struct _lf_module));
+	module->name = name;
+	module->index = 0;
+	module->device = device;
+	return device;
+}
+
+/* Returns the state of the endpoint of a device made by 'lf_test_device_create'. */
+static inline struct _lf_test_context *lf_test_context(struct _lf_device *device) {
+	return device->endpoint->_ctx;
+}
+
+#endif
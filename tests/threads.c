@@ -0,0 +1,89 @@
+/* threads.c - Drives several devices from several threads while they are attached and detached underneath them. */
+
+#include "test.h"
+#include <flipper/atomic.h>
+#include <pthread.h>
+
+#define THREADS 8
+#define DEVICES 4
+#define CALLS 20000
+#define DETACHES 500
+
+/* Invoked on whichever device the calling thread has selected. */
+struct _lf_module module = { "threads", NULL, LF_VERSION, 0, 0, NULL, NULL, NULL };
+
+/* Set once the threads making calls are done, so that the thread detaching devices stops. */
+uint32_t done;
+
+/* Attaches a new test device. */
+struct _lf_device *attach(void) {
+	struct _lf_module unused;
+	struct _lf_device *device = lf_test_device_create("threads", &unused);
+	lf_test(lf_attach(device) == lf_success, "Failed to attach a test device.");
+	return device;
+}
+
+/* Makes calls through devices picked from the attached devices, some of which are detached during the call. */
+void *caller(void *_id) {
+	uint32_t id = (uintptr_t)_id;
+	uint32_t succeeded = 0;
+	for (uint32_t i = 0; i < CALLS; i ++) {
+		/* Selected under the lock, so that a detach after the selection is noticed. The device may be detached before it is used, but it must not be used after it is released. */
+		lf_lock(&lf_attached_lock);
+		uint32_t count = lf_vector_count(&lf_attached_devices);
+		lf_set_thread_device(lf_vector_item(&lf_attached_devices, (id + i) % (count ? count : 1)));
+		lf_unlock(&lf_attached_lock);
+		uint32_t value = (id << 24) | i;
+		if (i % 4) {
+			lf_return_t result = lf_invoke(&module, 0, lf_uint32_t, lf_args(lf_uint32(value)));
+			if (lf_error_get() == E_OK) {
+				lf_test(result == value, "Thread %u received %u for call %u.", id, (unsigned)result, (unsigned)value);
+				succeeded ++;
+			}
+		} else {
+			/* Leave a few invocations outstanding at once. */
+			struct _lf_completion *completions[3];
+			for (int j = 0; j < 3; j ++) completions[j] = lf_invoke_async(&module, 0, lf_uint32_t, lf_args(lf_uint32(value + j)));
+			for (int j = 0; j < 3; j ++) {
+				if (!completions[j]) continue;
+				lf_error_clear();
+				lf_return_t result = lf_await(completions[j]);
+				if (lf_error_get() == E_OK) lf_test(result == value + j, "Thread %u received %u for call %u.", id, (unsigned)result, (unsigned)(value + j));
+			}
+		}
+		lf_error_clear();
+	}
+	lf_test(succeeded, "Thread %u made no calls.", id);
+	return NULL;
+}
+
+/* Detaches the attached devices one at a time, attaching a new one in place of each. */
+void *detacher(void *unused) {
+	for (int i = 0; i < DETACHES && !lf_atomic_load(&done); i ++) {
+		lf_lock(&lf_attached_lock);
+		struct _lf_device *device = lf_vector_item(&lf_attached_devices, 0);
+		lf_device_retain(device);
+		lf_unlock(&lf_attached_lock);
+		attach();
+		lf_detach(device);
+		lf_device_release(device);
+		sched_yield();
+	}
+	return NULL;
+}
+
+int main(void) {
+	/* Results are taken as they come, as the test device answers in order. */
+	for (int i = 0; i < DEVICES; i ++) lf_set_window(attach(), 4);
+
+	pthread_t callers[THREADS], detaching;
+	for (uintptr_t i = 0; i < THREADS; i ++) pthread_create(&callers[i], NULL, caller, (void *)i);
+	pthread_create(&detaching, NULL, detacher, NULL);
+	for (int i = 0; i < THREADS; i ++) pthread_join(callers[i], NULL);
+	lf_atomic_store(&done, 1);
+	pthread_join(detaching, NULL);
+
+	lf_test(lf_vector_count(&lf_attached_devices) == DEVICES, "%u devices are attached.", lf_vector_count(&lf_attached_devices));
+	printf("threads: ok\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/* usb.c - Checks that buffers pushed and pulled through the USB endpoint arrive whole, padded to packets, in few transfers. Runs against a stand-in for libusb. */
+
+#include "test.h"
+#include <libusb.h>
+#include <pthread.h>
+
+struct _lf_endpoint *lf_libusb_endpoint_for_device(struct libusb_context *usb, struct libusb_device *device);
+
+#define SIZE (1 << 20)
+
+/* What the stand-in device has been sent, and what it sends back. */
+uint8_t received[SIZE + BULK_OUT_SIZE];
+uint8_t sent[SIZE + BULK_IN_SIZE];
+size_t received_length, sent_length;
+
+/* The number of transfers made, the transfer that fails if any, and whether transfers can be allocated. */
+int transfers;
+int failing = -1;
+bool allocatable = true;
+
+/* Asynchronous transfers that have been submitted, completed in order by the event thread. */
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t submission = PTHREAD_COND_INITIALIZER;
+struct libusb_transfer *submitted[LF_USB_TRANSFERS * 2];
+int head, tail;
+
+/* The threads that have handled events, and the number of times event handling was interrupted. */
+pthread_t handlers[4];
+int handler_count, interrupts;
+bool interrupted;
+
+/* Moves a transfer's data to or from the stand-in device, and returns whether it succeeds. */
+bool move(unsigned char address, unsigned char *data, int length) {
+	if (transfers ++ == failing) return false;
+	if (address & USB_IN_MASK) {
+		memcpy(data, sent + sent_length, length);
+		sent_length += length;
+	} else {
+		memcpy(received + received_length, data, length);
+		received_length += length;
+	}
+	return true;
+}
+
+int libusb_open(libusb_device *device, libusb_device_handle **handle) {
+	*handle = (libusb_device_handle *)device;
+	return 0;
+}
+
+void libusb_close(libusb_device_handle *handle) {
+
+}
+
+libusb_device *libusb_ref_device(libusb_device *device) {
+	return device;
+}
+
+void libusb_unref_device(libusb_device *device) {
+
+}
+
+int libusb_claim_interface(libusb_device_handle *handle, int interface) {
+	return 0;
+}
+
+struct libusb_transfer *libusb_alloc_transfer(int packets) {
+	return (allocatable) ? calloc(1, sizeof(struct libusb_transfer)) : NULL;
+}
+
+void libusb_free_transfer(struct libusb_transfer *transfer) {
+	free(transfer);
+}
+
+int libusb_submit_transfer(struct libusb_transfer *transfer) {
+	pthread_mutex_lock(&lock);
+	submitted[tail ++ % (LF_USB_TRANSFERS * 2)] = transfer;
+	pthread_cond_signal(&submission);
+	pthread_mutex_unlock(&lock);
+	return 0;
+}
+
+int libusb_cancel_transfer(struct libusb_transfer *transfer) {
+	return 0;
+}
+
+/* Waits for a transfer to complete, or for event handling to be interrupted. */
+int libusb_handle_events_completed(libusb_context *context, int *completed) {
+	pthread_mutex_lock(&lock);
+	int known = 0;
+	while (known < handler_count && !pthread_equal(handlers[known], pthread_self())) known ++;
+	if (known == handler_count && handler_count < 4) handlers[handler_count ++] = pthread_self();
+	while (head == tail && !interrupted && !(completed && *completed)) pthread_cond_wait(&submission, &lock);
+	struct libusb_transfer *transfer = (head != tail) ? submitted[head ++ % (LF_USB_TRANSFERS * 2)] : NULL;
+	if (!transfer) interrupted = false;
+	pthread_mutex_unlock(&lock);
+	if (!transfer) return 0;
+	transfer->status = move(transfer->endpoint, transfer->buffer, transfer->length) ? LIBUSB_TRANSFER_COMPLETED : LIBUSB_TRANSFER_TIMED_OUT;
+	transfer->actual_length = transfer->length;
+	transfer->callback(transfer);
+	return 0;
+}
+
+void libusb_interrupt_event_handler(libusb_context *context) {
+	pthread_mutex_lock(&lock);
+	interrupted = true;
+	interrupts ++;
+	pthread_cond_signal(&submission);
+	pthread_mutex_unlock(&lock);
+}
+
+int libusb_bulk_transfer(libusb_device_handle *handle, unsigned char address, unsigned char *data, int length, int *transferred, unsigned int timeout) {
+	if (!move(address, data, length)) return LIBUSB_ERROR_TIMEOUT;
+	*transferred = length;
+	return 0;
+}
+
+/* Pushes and pulls buffers of assorted lengths, checking what the device receives and what is returned. */
+void round_trips(struct _lf_endpoint *endpoint, uint8_t *data) {
+	static uint8_t pulled[SIZE + 1];
+	for (size_t length = 1; length <= SIZE; length = length * 3 + 5) {
+		received_length = sent_length = 0;
+		lf_test(endpoint->push(endpoint, data, length) == lf_success, "Failed to push %zu bytes.", length);
+		lf_test(received_length == lf_ceiling(length, BULK_OUT_SIZE) * BULK_OUT_SIZE, "Pushing %zu bytes sent %zu.", length, received_length);
+		lf_test(!memcmp(received, data, length), "Pushing %zu bytes changed them.", length);
+		for (size_t i = length; i < received_length; i ++) lf_test(!received[i], "Pushing %zu bytes was not padded with zeroes.", length);
+		memcpy(sent, data, length);
+		memset(pulled, 0xee, length + 1);
+		lf_test(endpoint->pull(endpoint, pulled, length) == lf_success, "Failed to pull %zu bytes.", length);
+		lf_test(!memcmp(pulled, data, length), "Pulling %zu bytes changed them.", length);
+		lf_test(pulled[length] == 0xee, "Pulling %zu bytes wrote past them.", length);
+	}
+}
+
+int main(void) {
+	static uint8_t data[SIZE];
+	for (size_t i = 0; i < SIZE; i ++) data[i] = rand();
+	/* The stand-in device is only ever passed back to the stand-in functions. */
+	static int device;
+
+	/* Buffers larger than a packet are streamed through the transfer ring, which moves the caller's buffer a transfer at a time. */
+	struct _lf_endpoint *endpoint = lf_libusb_endpoint_for_device(NULL, (libusb_device *)&device);
+	lf_test(endpoint, "Failed to create the endpoint.");
+	round_trips(endpoint, data);
+	transfers = 0;
+	received_length = 0;
+	lf_test(endpoint->push(endpoint, data, SIZE) == lf_success, "Failed to push a large buffer.");
+	lf_test(transfers == SIZE / LF_USB_TRANSFER_SIZE, "Pushing %i bytes took %i transfers.", SIZE, transfers);
+
+	/* A transfer that fails fails the push, once the others in flight have finished. */
+	transfers = 0;
+	received_length = 0;
+	failing = 3;
+	lf_error_pause();
+	lf_test(endpoint->push(endpoint, data, 90000) == lf_error, "A push whose transfer failed succeeded.");
+	lf_test(lf_error_get() == E_TIMEOUT, "A transfer that timed out was reported as error %i.", lf_error_get());
+	lf_error_resume();
+	lf_error_clear();
+	failing = -1;
+
+	/* Every endpoint shares one event thread, which stops once the last of them is released. */
+	struct _lf_endpoint *other = lf_libusb_endpoint_for_device(NULL, (libusb_device *)&device);
+	lf_test(other, "Failed to create a second endpoint.");
+	received_length = 0;
+	lf_test(other->push(other, data, 90000) == lf_success, "Failed to push through the second endpoint.");
+	lf_endpoint_release(endpoint);
+	received_length = 0;
+	lf_test(other->push(other, data, 90000) == lf_success, "Failed to push once the first endpoint was released.");
+	lf_test(handler_count == 1, "%i threads handled the events of two endpoints.", handler_count);
+	lf_test(interrupts == 0, "The event thread was stopped while an endpoint still used it.");
+	lf_endpoint_release(other);
+	lf_test(interrupts == 1, "The event thread was interrupted %i times once the last endpoint was released.", interrupts);
+	endpoint = lf_libusb_endpoint_for_device(NULL, (libusb_device *)&device);
+	received_length = 0;
+	lf_test(endpoint->push(endpoint, data, 90000) == lf_success, "Failed to push once the event thread was restarted.");
+	lf_endpoint_release(endpoint);
+	lf_test(interrupts == 2, "The restarted event thread was not stopped.");
+
+	/* Without a transfer ring, the whole packets of a buffer go in one blocking transfer and the rest in another. */
+	allocatable = false;
+	endpoint = lf_libusb_endpoint_for_device(NULL, (libusb_device *)&device);
+	lf_test(endpoint, "Failed to create the endpoint without a transfer ring.");
+	lf_error_clear();
+	round_trips(endpoint, data);
+	transfers = 0;
+	received_length = 0;
+	lf_test(endpoint->push(endpoint, data, SIZE - 10) == lf_success, "Failed to push a large buffer.");
+	lf_test(transfers == 2, "Pushing %i bytes took %i transfers.", SIZE - 10, transfers);
+	lf_endpoint_release(endpoint);
+
+	printf("usb: ok\n");
+	return EXIT_SUCCESS;
+}
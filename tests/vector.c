@@ -0,0 +1,74 @@
+/* vector.c - Checks that vectors keep the items appended to them in order, through random appends and removals, and release them as they go. */
+
+#include "test.h"
+
+#define ITEMS 64
+#define OPERATIONS 100000
+
+int items[ITEMS];
+/* The number of times each item has been released. */
+int released[ITEMS];
+
+int release_item(void *item) {
+	released[(int *)item - items] ++;
+	return lf_success;
+}
+
+void sum_item(const void *item, void *_ctx) {
+	*(int *)_ctx += *(const int *)item;
+}
+
+int main(void) {
+	for (int i = 0; i < ITEMS; i ++) items[i] = i;
+	struct _lf_vector vector = LF_VECTOR(release_item);
+	lf_test(lf_vector_count(&vector) == 0 && !lf_vector_item(&vector, 0), "A new vector is not empty.");
+
+	/* The reference holds the items expected in the vector, in order, and how many times each should have been released. */
+	static int reference[OPERATIONS];
+	int count = 0;
+	int expected[ITEMS] = { 0 };
+	srand(1);
+	for (int op = 0; op < OPERATIONS; op ++) {
+		int i = rand() % ITEMS;
+		if (rand() % 3) {
+			lf_test(lf_vector_append(&vector, &items[i]) == lf_success, "Failed to append an item.");
+			reference[count ++] = i;
+		} else {
+			/* Removing an item releases every copy of it and keeps the rest in order. */
+			lf_vector_remove(&vector, &items[i]);
+			int kept = 0;
+			for (int j = 0; j < count; j ++) {
+				if (reference[j] == i) expected[i] ++;
+				else reference[kept ++] = reference[j];
+			}
+			count = kept;
+			lf_test(!lf_vector_contains(&vector, &items[i]), "A removed item is still in the vector.");
+		}
+		lf_test(lf_vector_count(&vector) == (uint32_t)count, "The vector holds %u items rather than %i.", lf_vector_count(&vector), count);
+		lf_test(vector.count <= vector.capacity, "The vector holds more items than it has room for.");
+		if (op % 1000 == 0) {
+			for (int j = 0; j < count; j ++) lf_test(lf_vector_item(&vector, j) == &items[reference[j]], "Item %i is out of order.", j);
+			lf_test(!lf_vector_item(&vector, count), "An item was returned past the end of the vector.");
+		}
+	}
+	for (int i = 0; i < ITEMS; i ++) lf_test(released[i] == expected[i], "Item %i was released %i times rather than %i.", i, released[i], expected[i]);
+
+	/* Applying a function visits every item once. */
+	int sum = 0, total = 0;
+	lf_vector_apply_func(&vector, sum_item, &sum);
+	for (int j = 0; j < count; j ++) total += reference[j];
+	lf_test(sum == total, "Applying a function summed %i rather than %i.", sum, total);
+
+	/* Releasing the vector releases what it still holds and leaves it empty. */
+	for (int j = 0; j < count; j ++) expected[reference[j]] ++;
+	lf_test(lf_vector_release(&vector) == lf_success, "Failed to release the vector.");
+	for (int i = 0; i < ITEMS; i ++) lf_test(released[i] == expected[i], "Item %i was released %i times rather than %i.", i, released[i], expected[i]);
+	lf_test(lf_vector_count(&vector) == 0 && !vector.items, "A released vector is not empty.");
+
+	/* A released vector can be used again. */
+	lf_test(lf_vector_append(&vector, &items[0]) == lf_success && lf_vector_item(&vector, 0) == &items[0], "A released vector could not be reused.");
+	lf_vector_release(&vector);
+
+	printf("vector: ok\n");
+	return EXIT_SUCCESS;
+}
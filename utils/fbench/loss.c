@@ -0,0 +1,31 @@
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+/* loss - Drops outgoing datagrams at random, to measure how transports recover. Preloaded into a host or fvm, with LOSS set to the fraction of datagrams dropped. */
+
+double loss = -1;
+
+/* Returns whether to drop the next datagram. */
+int loss_drop(void) {
+	if (loss < 0) {
+		char *fraction = getenv("LOSS");
+		loss = (fraction) ? atof(fraction) : 0;
+		srand(getpid());
+	}
+	return rand() < loss * RAND_MAX;
+}
+
+/* Reports a dropped datagram as sent, as the network would. */
+ssize_t sendmsg(int fd, const struct msghdr *message, int flags) {
+	static ssize_t (* next)(int, const struct msghdr *, int);
+	if (!next) next = dlsym(RTLD_NEXT, "sendmsg");
+	if (loss_drop()) {
+		ssize_t length = 0;
+		for (size_t i = 0; i < message->msg_iovlen; i ++) length += message->msg_iov[i].iov_len;
+		return length;
+	}
+	return next(fd, message, flags);
+}
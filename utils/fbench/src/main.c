@@ -0,0 +1,110 @@
+#include <flipper.h>
+#include <flipper/posix/shm.h>
+#include <flipper/posix/stream.h>
+#include <unistd.h>
+#include <time.h>
+
+/* fbench - Measures invocation latency and push throughput against a device, usually fvm. */
+
+/* The number of invocations timed, and the number and size of the pushes timed. */
+int fbench_rounds = 2000;
+#define FBENCH_PUSHES 8
+#define FBENCH_PUSH_SIZE (256 << 10)
+
+void fbench_usage(char *name) {
+	fprintf(stderr, "Usage: %s [-r rounds] [-t | -u path | -s name] [hostname]\n", name);
+	fprintf(stderr, "  -r  The number of invocations timed. %i by default.\n", fbench_rounds);
+	fprintf(stderr, "  -t  Attach over TCP rather than UDP.\n");
+	fprintf(stderr, "  -u  Attach over a Unix domain socket at the given path, usually '%s'.\n", LF_UNIX_PATH);
+	fprintf(stderr, "  -s  Attach over a shared memory region with the given name, usually '%s'.\n", LF_SHM_NAME);
+	fprintf(stderr, "Otherwise attaches to the hostname given, or to 'localhost'.\n");
+}
+
+double fbench_now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+int fbench_compare(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[]) {
+
+	bool tcp = false;
+	char *path = NULL;
+	char *name = NULL;
+
+	int option;
+	while ((option = getopt(argc, argv, "r:tu:s:")) != -1) {
+		switch (option) {
+			case 'r':
+				fbench_rounds = strtoul(optarg, NULL, 0);
+			break;
+			case 't':
+				tcp = true;
+			break;
+			case 'u':
+				path = optarg;
+			break;
+			case 's':
+				name = optarg;
+			break;
+			default:
+				fbench_usage(argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	char *hostname = (optind < argc) ? argv[optind] : "localhost";
+
+	double *latencies = NULL;
+	uint8_t *buffer = NULL;
+
+	struct _lf_device *device;
+	if (name) {
+		device = carbon_attach_shm(name);
+	} else if (path) {
+		device = carbon_attach_unix(path);
+	} else if (tcp) {
+		device = carbon_attach_tcp(hostname);
+	} else {
+		device = carbon_attach_hostname(hostname);
+	}
+	lf_assert(device, failure, E_ENDPOINT, "Failed to attach to '%s'.", (name) ? name : (path) ? path : hostname);
+	lf_assert(fbench_rounds > 0, failure, E_OVERFLOW, "At least one round must be timed.");
+
+	/* Times invocations that each make a full round trip to the device. */
+	latencies = malloc(fbench_rounds * sizeof(double));
+	lf_assert(latencies, failure, E_MALLOC, "Failed to allocate the latencies.");
+	int errors = 0;
+	for (int i = 0; i < fbench_rounds; i ++) {
+		double start = fbench_now();
+		gpio_read(i);
+		latencies[i] = fbench_now() - start;
+		if (lf_error_get() != E_OK) errors ++;
+		lf_error_clear();
+	}
+	qsort(latencies, fbench_rounds, sizeof(double), fbench_compare);
+	printf("invoke: p50 %.1f us, p99 %.1f us, max %.1f us, %i errors\n", latencies[fbench_rounds / 2] * 1e6, latencies[fbench_rounds * 99 / 100] * 1e6, latencies[fbench_rounds - 1] * 1e6, errors);
+
+	/* Times pushes large enough to be carried as many frames. */
+	buffer = malloc(FBENCH_PUSH_SIZE);
+	lf_assert(buffer, failure, E_MALLOC, "Failed to allocate the buffer.");
+	for (int i = 0; i < FBENCH_PUSH_SIZE; i ++) buffer[i] = i;
+	double start = fbench_now();
+	int failed = 0;
+	for (int i = 0; i < FBENCH_PUSHES; i ++) if (uart0_push(buffer, FBENCH_PUSH_SIZE) != lf_success) failed ++;
+	double elapsed = fbench_now() - start;
+	printf("push: %.1f MB/s over %i pushes of %i KiB, %i failed\n", FBENCH_PUSHES * FBENCH_PUSH_SIZE / elapsed / 1e6, FBENCH_PUSHES, FBENCH_PUSH_SIZE >> 10, failed);
+
+	free(latencies);
+	free(buffer);
+	return EXIT_SUCCESS;
+
+failure:
+	free(latencies);
+	free(buffer);
+	return EXIT_FAILURE;
+}
@@ -4,6 +4,10 @@
 #define _GNU_SOURCE
 #include <dlfcn.h>
 #include <flipper/posix/network.h>
+#include <flipper/posix/shm.h>
+#include <flipper/posix/stream.h>
+#include <netinet/tcp.h>
+#include <sys/un.h>
 
 /* fserve - Creates a local server that acts as a virtual flipper device. */
 
@@ -17,6 +21,39 @@ int modulec = 0;
 
 struct _lf_endpoint *nep = NULL;
 
+/* The configuration advertised to the host. Adjusted from the command line to emulate other devices. */
+struct _lf_configuration fmr_configuration = {
+	"fvm",
+	0,
+	LF_VERSION,
+	lf_device_32bit | lf_device_little_endian,
+	FMR_MAX_PACKET_SIZE,
+	LF_MAX_OUTSTANDING,
+	lf_capability_batch | lf_capability_inline | lf_capability_deferred | lf_capability_modules,
+	0
+};
+
+/* If set, the configuration is not reported, emulating firmware that predates it. */
+bool fvm_legacy = false;
+
+/* If set, the host connects using TCP or a Unix domain socket at the given path rather than UDP. */
+bool fvm_tcp = false;
+char *fvm_unix = NULL;
+/* If set, the host attaches over the shared memory region with this name. */
+char *fvm_shm = NULL;
+
+void fvm_usage(char *name) {
+	fprintf(stderr, "Usage: %s [-f frame size] [-w window] [-m capabilities] [-c clock] [-l] [-t | -u path | -s name] [module ...]\n", name);
+	fprintf(stderr, "  -f  The largest frame accepted, in bytes. At most %i.\n", FMR_MAX_PACKET_SIZE);
+	fprintf(stderr, "  -w  The number of invocations that may be outstanding.\n");
+	fprintf(stderr, "  -m  The mask of supported capabilities. 0x1 (unchecked), 0x2 (batch), 0x4 (inline), 0x8 (deferred), 0x20 (modules).\n");
+	fprintf(stderr, "  -c  The clock rate reported, in hertz.\n");
+	fprintf(stderr, "  -l  Do not report a configuration, as firmware that predates it.\n");
+	fprintf(stderr, "  -t  Listen for TCP connections on port %i rather than UDP datagrams.\n", LF_TCP_PORT);
+	fprintf(stderr, "  -u  Listen for connections on a Unix domain socket at the given path, usually '%s'.\n", LF_UNIX_PATH);
+	fprintf(stderr, "  -s  Serve hosts over a shared memory region with the given name, usually '%s'.\n", LF_SHM_NAME);
+}
+
 int fld_index(lf_crc_t identifier) {
 	lf_debug("Searching for counterpart module to '0x%04x'.", identifier);
 	for (int i = 0; i < modulec; i ++) {
@@ -30,6 +67,14 @@ int fld_index(lf_crc_t identifier) {
 	return -1;
 }
 
+int fld_table(lf_crc_t *identifiers, lf_size_t length) {
+	for (int i = 0; i < modulec && (i + 1) * sizeof(lf_crc_t) <= length; i ++) {
+		char *name = fvm_modules[i].name;
+		identifiers[i] = lf_crc(name, strlen(name) + 1);
+	}
+	return modulec;
+}
+
 int fvm_load_module(char *path) {
 	void *dlm = dlopen(path, RTLD_LAZY);
 	lf_assert(dlm, failure, E_NULL, "Failed to open '%s'.", path);
@@ -57,17 +102,151 @@ failure:
 	return lf_error;
 }
 
+/* Performs the packets that arrive over the endpoint. Returns when a stream's connection is closed. */
+void fvm_serve(bool stream) {
+	while (1) {
+		struct _fmr_packet packet;
+		/* Each frame arrives as a single message of 'header.length' bytes. */
+		if (nep->pull(nep, &packet, sizeof(struct _fmr_packet)) != lf_success) {
+			/* A stream cannot recover its framing once a pull has failed. */
+			if (stream) return;
+			continue;
+		}
+		lf_debug_packet(&packet, packet.header.length);
+		struct _fmr_reply reply;
+		lf_error_clear();
+		lf_size_t size = fmr_perform(&packet, &reply);
+		/* Older firmware answers the configuration packet it does not recognize with a bare result. */
+		if (fvm_legacy && packet.header.type == fmr_configuration_class) {
+			reply.result.value = 0;
+			size = sizeof(struct _fmr_result);
+		}
+		lf_debug_result(&reply.result);
+		if (packet.header.type == fmr_configuration_class && size > sizeof(struct _fmr_result)) {
+			/* The host reads the configuration separately from its result, so it is sent as a message of its own. */
+			nep->push(nep, &reply.result, sizeof(struct _fmr_result));
+			nep->push(nep, reply.data, size - sizeof(struct _fmr_result));
+		} else if (size) {
+			nep->push(nep, &reply, size);
+		}
+	}
+}
+
+/* Serves one connection at a time over TCP or a Unix domain socket. */
+int fvm_listen(void) {
+	int sd;
+	char *where;
+	if (fvm_unix) {
+		struct sockaddr_un addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		lf_assert(strlen(fvm_unix) < sizeof(addr.sun_path), failure, E_OVERFLOW, "The socket path '%s' is too long.", fvm_unix);
+		strcpy(addr.sun_path, fvm_unix);
+		sd = socket(AF_UNIX, SOCK_STREAM, 0);
+		lf_assert(sd >= 0, failure, E_SOCKET, "Failed to get socket.");
+		/* Remove the socket left behind by a previous server. */
+		unlink(fvm_unix);
+		int _e = bind(sd, (struct sockaddr *)&addr, sizeof(addr));
+		lf_assert(_e == 0, failure, E_SOCKET, "Failed to create server at '%s'.", fvm_unix);
+		where = fvm_unix;
+	} else {
+		struct sockaddr_in addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_port = htons(LF_TCP_PORT);
+		addr.sin_addr.s_addr = htonl(INADDR_ANY);
+		sd = socket(AF_INET, SOCK_STREAM, 0);
+		lf_assert(sd >= 0, failure, E_SOCKET, "Failed to get socket.");
+		int reuse = 1;
+		setsockopt(sd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+		int _e = bind(sd, (struct sockaddr *)&addr, sizeof(addr));
+		lf_assert(_e == 0, failure, E_SOCKET, "Failed to create server on port %i.", LF_TCP_PORT);
+		where = "localhost";
+	}
+	int _e = listen(sd, 1);
+	lf_assert(_e == 0, failure, E_SOCKET, "Failed to listen for connections.");
+
+	printf("Flipper Virtual Machine (FVM) v0.1.0\nListening on '%s'.\n\n", where);
+
+	while (1) {
+		int fd = accept(sd, NULL, NULL);
+		if (fd < 0) continue;
+		if (!fvm_unix) {
+			int nodelay = 1;
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+		}
+		nep = lf_stream_endpoint_for_socket(fd, where);
+		if (!nep) {
+			close(fd);
+			continue;
+		}
+		fvm_serve(true);
+		lf_endpoint_release(nep);
+	}
+
+failure:
+	return EXIT_FAILURE;
+}
+
+/* Serves hosts that attach over shared memory. Each host that attaches takes over from the one before it. */
+int fvm_share(void) {
+	nep = lf_shm_endpoint_create(fvm_shm);
+	lf_assert(nep, failure, E_ENDPOINT, "Failed to create shared memory '%s'.", fvm_shm);
+
+	printf("Flipper Virtual Machine (FVM) v0.1.0\nListening on '%s'.\n\n", fvm_shm);
+
+	while (1) fvm_serve(true);
+
+failure:
+	return EXIT_FAILURE;
+}
+
 int main(int argc, char *argv[]) {
 
 	//lf_set_debug_level(LF_DEBUG_LEVEL_ALL);
 
-	if (argc > 1) {
-		char **modules = &argv[1];
-		for (int i = 0; i < (argc-1); i ++) {
-			lf_debug("Loading package '%s'.", *modules);
-			fvm_load_module(*modules++);
+	int option;
+	while ((option = getopt(argc, argv, "f:w:m:c:ltu:s:")) != -1) {
+		switch (option) {
+			case 'f':
+				fmr_configuration.frame_size = strtoul(optarg, NULL, 0);
+				if (fmr_configuration.frame_size > FMR_MAX_PACKET_SIZE) fmr_configuration.frame_size = FMR_MAX_PACKET_SIZE;
+			break;
+			case 'w':
+				fmr_configuration.window = strtoul(optarg, NULL, 0);
+			break;
+			case 'm':
+				fmr_configuration.capabilities = strtoul(optarg, NULL, 0);
+			break;
+			case 'c':
+				fmr_configuration.clock = strtoul(optarg, NULL, 0);
+			break;
+			case 'l':
+				fvm_legacy = true;
+			break;
+			case 't':
+				fvm_tcp = true;
+			break;
+			case 'u':
+				fvm_unix = optarg;
+			break;
+			case 's':
+				fvm_shm = optarg;
+			break;
+			default:
+				fvm_usage(argv[0]);
+				return EXIT_FAILURE;
 		}
 	}
+	fmr_configuration.identifier = lf_crc(fmr_configuration.name, strlen(fmr_configuration.name) + 1);
+
+	for (int i = optind; i < argc; i ++) {
+		lf_debug("Loading package '%s'.", argv[i]);
+		fvm_load_module(argv[i]);
+	}
+
+	if (fvm_shm) return fvm_share();
+	if (fvm_tcp || fvm_unix) return fvm_listen();
 
 	/* Create a UDP server. */
 	struct sockaddr_in addr;
@@ -97,19 +276,11 @@ int main(int argc, char *argv[]) {
 	lf_assert(nep, failure, E_ENDPOINT, "Failed to create endpoint for networked device.");
 	context = (struct _lf_network_context *)nep->_ctx;
 	context->fd = sd;
+	lf_network_initialize(context);
 
 	printf("Flipper Virtual Machine (FVM) v0.1.0\nListening on 'localhost'.\n\n");
 
-	while (1) {
-		struct _fmr_packet packet;
-		nep->pull(nep, &packet, sizeof(struct _fmr_packet));
-		lf_debug_packet(&packet, sizeof(struct _fmr_packet));
-		struct _fmr_result result;
-		lf_error_clear();
-		fmr_perform(&packet, &result);
-		lf_debug_result(&result);
-		nep->push(nep, &result, sizeof(struct _fmr_result));
-	}
+	fvm_serve(false);
 
 	close(sd);
 
@@ -142,3 +313,13 @@ lf_return_t fmr_pull(struct _fmr_push_pull_packet *packet) {
 failure:
 	return lf_error;
 }
+
+lf_return_t fmr_batch(struct _fmr_batch_packet *packet) {
+	struct _fmr_result results[FMR_MAX_BATCH];
+	memset(results, 0, sizeof(results));
+	lf_size_t count = (packet->count < FMR_MAX_BATCH) ? packet->count : FMR_MAX_BATCH;
+	int performed = fmr_execute_batch(packet, results);
+	/* The host always expects one result per invocation in the batch. */
+	nep->push(nep, results, count * sizeof(struct _fmr_result));
+	return performed;
+}